@@ -0,0 +1,134 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <NekiraDelegate/SignalSlot/SignalType.hpp>
+
+
+namespace NekiraDelegate
+{
+// 可并发重新绑定的单播委托
+// Invoke 是无等待的，可以在任意线程与 Bind/RemoveBinding 并发执行，不加锁、不分配内存、不修改引用计数
+// 被替换的回调在所有正在执行的调用结束之前保持有效，之后在下一次重新绑定或委托析构时释放
+// 回调中也可以重新绑定或断开本委托
+// @[INFO] 移动与析构不是线程安全的，需要保证此时没有其他线程在使用委托
+// @[INFO] 成员函数的接收者析构时不会等待正在执行的回调，接收者必须在所有并发的 Invoke 结束后才能析构
+// @[INFO] 同一个接收者的绑定与析构不能在多个线程中并发进行
+template <typename RT, typename... Args>
+class AtomicDelegate final
+{
+private:
+    // 单播信号实例
+    std::unique_ptr<AtomicSingleSignal<RT, Args...>> Signal;
+
+public:
+    AtomicDelegate() : Signal(std::make_unique<AtomicSingleSignal<RT, Args...>>())
+    {}
+
+    ~AtomicDelegate()
+    {
+        RemoveBinding();
+        Signal.reset();
+    }
+
+    AtomicDelegate(const AtomicDelegate&) = delete;
+    AtomicDelegate(AtomicDelegate&& other) noexcept : Signal(std::move(other.Signal))
+    {}
+
+    AtomicDelegate& operator=(const AtomicDelegate&) = delete;
+    AtomicDelegate& operator=(AtomicDelegate&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Signal = std::move(other.Signal);
+        }
+        return *this;
+    }
+
+    // 是否有效
+    [[nodiscard]] bool IsValid() const
+    {
+        return Signal && Signal->IsValid();
+    }
+
+    // 执行连接的回调
+    RT Invoke(Args&&... args) const
+    {
+        return Signal ? Signal->Invoke(std::forward<Args>(args)...) : RT{};
+    }
+
+    // 断开连接
+    void RemoveBinding()
+    {
+        if (Signal)
+        {
+            Signal->Disconnect();
+        }
+    }
+
+    // 绑定普通函数
+    void BindFunction(RT (*FuncPtr)(Args...))
+    {
+        if (Signal)
+        {
+            Signal->Connect(FuncPtr);
+        }
+    }
+
+    // 绑定普通成员函数,要求继承 IConnectionInterface接口
+    template <typename ClassType>
+        requires std::is_base_of_v<IConnectionInterface, ClassType>
+    void BindMemberFunction(ClassType* Object, RT (ClassType::*FuncPtr)(Args...))
+    {
+        if (Signal)
+        {
+            Signal->Connect(Object, FuncPtr);
+        }
+    }
+
+    // 绑定const成员函数,要求继承 IConnectionInterface接口
+    template <typename ClassType>
+        requires std::is_base_of_v<IConnectionInterface, ClassType>
+    void BindMemberFunction(const ClassType* Object, RT (ClassType::*FuncPtr)(Args...) const)
+    {
+        if (Signal)
+        {
+            Signal->Connect(Object, FuncPtr);
+        }
+    }
+
+    // 绑定函数对象，lambda表达式
+    template <typename Callable>
+        requires std::is_invocable_r_v<RT, Callable, Args...>
+    void BindFunctionObject(Callable&& Func)
+    {
+        if (Signal)
+        {
+            Signal->Connect(std::forward<Callable>(Func));
+        }
+    }
+};
+} // namespace NekiraDelegate
@@ -29,30 +29,30 @@
 
 namespace NekiraDelegate
 {
-// 单播委托
-template <typename RT, typename... Args>
-class Delegate final
+// 单播委托，Policy 决定连接器的持有方式
+template <typename Policy, typename RT, typename... Args>
+class BasicDelegate final
 {
 private:
     // 单播信号实例
-    std::unique_ptr<SingleSignal<RT, Args...>> Signal;
+    std::unique_ptr<BasicSingleSignal<Policy, RT, Args...>> Signal;
 
 public:
-    Delegate() : Signal(std::make_unique<SingleSignal<RT, Args...>>())
+    BasicDelegate() : Signal(std::make_unique<BasicSingleSignal<Policy, RT, Args...>>())
     {}
 
-    ~Delegate()
+    ~BasicDelegate()
     {
         RemoveBinding();
         Signal.reset();
     }
 
-    Delegate(const Delegate&) = delete;
-    Delegate(Delegate&& other) noexcept : Signal(std::move(other.Signal))
+    BasicDelegate(const BasicDelegate&) = delete;
+    BasicDelegate(BasicDelegate&& other) noexcept : Signal(std::move(other.Signal))
     {}
 
-    Delegate& operator=(const Delegate&) = delete;
-    Delegate& operator=(Delegate&& other) noexcept
+    BasicDelegate& operator=(const BasicDelegate&) = delete;
+    BasicDelegate& operator=(BasicDelegate&& other) noexcept
     {
         if (this != &other)
         {
@@ -124,35 +124,43 @@ public:
         }
     }
 };
+
+// 单播委托
+template <typename RT, typename... Args>
+using Delegate = BasicDelegate<SharedConnectionPolicy, RT, Args...>;
+
+// 单线程单播委托，使用非原子的侵入式引用计数
+template <typename RT, typename... Args>
+using SingleThreadDelegate = BasicDelegate<IntrusiveConnectionPolicy, RT, Args...>;
 } // namespace NekiraDelegate
 
 
 
 namespace NekiraDelegate
 {
-// 多播委托
-template <typename... Args>
-class MultiDelegate final
+// 多播委托，Policy 决定连接器的持有方式
+template <typename Policy, typename... Args>
+class BasicMultiDelegate final
 {
 private:
     // 多播信号实例
-    std::unique_ptr<MultiSignal<Args...>> Signal;
+    std::unique_ptr<BasicMultiSignal<Policy, Args...>> Signal;
 
 public:
-    MultiDelegate() : Signal(std::make_unique<MultiSignal<Args...>>())
+    BasicMultiDelegate() : Signal(std::make_unique<BasicMultiSignal<Policy, Args...>>())
     {}
-    ~MultiDelegate()
+    ~BasicMultiDelegate()
     {
         RemoveAll();
         Signal.reset();
     }
 
-    MultiDelegate(const MultiDelegate&) = delete;
-    MultiDelegate(MultiDelegate&& other) noexcept : Signal(std::move(other.Signal))
+    BasicMultiDelegate(const BasicMultiDelegate&) = delete;
+    BasicMultiDelegate(BasicMultiDelegate&& other) noexcept : Signal(std::move(other.Signal))
     {}
 
-    MultiDelegate& operator=(const MultiDelegate&) = delete;
-    MultiDelegate& operator=(MultiDelegate&& other) noexcept
+    BasicMultiDelegate& operator=(const BasicMultiDelegate&) = delete;
+    BasicMultiDelegate& operator=(BasicMultiDelegate&& other) noexcept
     {
         if(this != &other)
         {
@@ -185,6 +193,48 @@ public:
         }
     }
 
+    // 断开某个接收者的所有成员函数绑定
+    void RemoveAllFor(const IConnectionInterface* Receiver)
+    {
+        if (Signal)
+        {
+            Signal->DisconnectAllFor(static_cast<const void*>(Receiver));
+        }
+    }
+
+    // 断开以 Owner 为标记绑定的所有函数对象
+    void RemoveAllFor(const void* Owner)
+    {
+        if (Signal)
+        {
+            Signal->DisconnectAllFor(Owner);
+        }
+    }
+
+    // 分配一个全局唯一的分组，用于 Bind 系列函数与 RemoveGroup
+    [[nodiscard]] static MultiSignalGroup NewGroup()
+    {
+        return MultiSignalGroup::Allocate();
+    }
+
+    // 断开某个分组的所有连接
+    void RemoveGroup(const MultiSignalGroup& Group)
+    {
+        if (Signal)
+        {
+            Signal->DisconnectGroup(Group);
+        }
+    }
+
+    // 预留连接的容量
+    void Reserve(std::size_t Count)
+    {
+        if (Signal)
+        {
+            Signal->Reserve(Count);
+        }
+    }
+
     // 断开所有连接
     void RemoveAll()
     {
@@ -195,33 +245,77 @@ public:
     }
 
     // 连接普通函数
-    MultiSignalHandle BindFunction(void (*FuncPtr)(Args...))
+    MultiSignalHandle BindFunction(void (*FuncPtr)(Args...), const MultiSignalGroup& Group = {})
     {
-        return Signal ? Signal->Connect(FuncPtr) : MultiSignalHandle{};
+        return Signal ? Signal->Connect(FuncPtr, Group) : MultiSignalHandle{};
     }
 
     // 连接普通成员函数,要求继承 IConnectionInterface接口
     template <typename ClassType>
         requires std::is_base_of_v<IConnectionInterface, ClassType>
-    MultiSignalHandle BindMemberFunction(ClassType* Object, void (ClassType::*FuncPtr)(Args...))
+    MultiSignalHandle BindMemberFunction(ClassType* Object, void (ClassType::*FuncPtr)(Args...),
+                                         const MultiSignalGroup& Group = {})
     {
-        return Signal ? Signal->Connect(Object, FuncPtr) : MultiSignalHandle{};
+        return Signal ? Signal->Connect(Object, FuncPtr, Group) : MultiSignalHandle{};
     }
 
     // 连接const成员函数,要求继承 IConnectionInterface接口
     template <typename ClassType>
         requires std::is_base_of_v<IConnectionInterface, ClassType>
-    MultiSignalHandle BindMemberFunction(const ClassType* Object, void (ClassType::*FuncPtr)(Args...) const)
+    MultiSignalHandle BindMemberFunction(const ClassType* Object, void (ClassType::*FuncPtr)(Args...) const,
+                                         const MultiSignalGroup& Group = {})
     {
-        return Signal ? Signal->Connect(Object, FuncPtr) : MultiSignalHandle{};
+        return Signal ? Signal->Connect(Object, FuncPtr, Group) : MultiSignalHandle{};
     }
 
     // 连接函数对象，lambda表达式
     template <typename Callable>
         requires std::is_invocable_r_v<void, Callable, Args...>
-    MultiSignalHandle BindFunctionObject(Callable&& Func)
+    MultiSignalHandle BindFunctionObject(Callable&& Func, const MultiSignalGroup& Group = {})
     {
-        return Signal ? Signal->Connect(std::forward<Callable>(Func)) : MultiSignalHandle{};
+        return Signal ? Signal->Connect(std::forward<Callable>(Func), Group) : MultiSignalHandle{};
+    }
+
+    // 连接函数对象，lambda表达式，并以 Owner 作为标记，之后可以通过 RemoveAllFor(Owner) 批量断开
+    template <typename Callable>
+        requires std::is_invocable_r_v<void, Callable, Args...>
+    MultiSignalHandle BindFunctionObject(const void* Owner, Callable&& Func, const MultiSignalGroup& Group = {})
+    {
+        return Signal ? Signal->Connect(Owner, std::forward<Callable>(Func), Group) : MultiSignalHandle{};
+    }
+
+    // 批量连接一组函数对象，所有连接器在一次分配中创建
+    template <typename Range>
+        requires std::ranges::sized_range<Range>
+                 && std::is_invocable_r_v<void, std::ranges::range_reference_t<Range>, Args...>
+    std::vector<MultiSignalHandle> BindRange(Range&& Callables, const MultiSignalGroup& Group = {})
+    {
+        return Signal ? Signal->ConnectRange(std::forward<Range>(Callables), Group) : std::vector<MultiSignalHandle>{};
+    }
+
+    // 批量连接多个函数对象，lambda表达式，所有连接器在一次分配中创建
+    template <typename... Callables>
+        requires(sizeof...(Callables) > 0 && (std::is_invocable_r_v<void, Callables, Args...> && ...))
+    std::vector<MultiSignalHandle> BindMany(const MultiSignalGroup& Group, Callables&&... Funcs)
+    {
+        return Signal ? Signal->ConnectMany(Group, std::forward<Callables>(Funcs)...)
+                      : std::vector<MultiSignalHandle>{};
+    }
+
+    // 批量连接多个函数对象，lambda表达式，不指定分组
+    template <typename... Callables>
+        requires(sizeof...(Callables) > 0 && (std::is_invocable_r_v<void, Callables, Args...> && ...))
+    std::vector<MultiSignalHandle> BindMany(Callables&&... Funcs)
+    {
+        return BindMany(MultiSignalGroup{}, std::forward<Callables>(Funcs)...);
     }
 };
+
+// 多播委托
+template <typename... Args>
+using MultiDelegate = BasicMultiDelegate<SharedConnectionPolicy, Args...>;
+
+// 单线程多播委托，使用非原子的侵入式引用计数
+template <typename... Args>
+using SingleThreadMultiDelegate = BasicMultiDelegate<IntrusiveConnectionPolicy, Args...>;
 } // namespace NekiraDelegate
@@ -24,7 +24,9 @@
 
 #pragma once
 
+#include <NekiraDelegate/Core/AtomicDelegate.hpp>
 #include <NekiraDelegate/Core/Delegate.hpp>
+#include <NekiraDelegate/Core/StaticDelegate.hpp>
 
 #ifndef NEKIRA_SINGLE_DELEGATE
 #define NEKIRA_SINGLE_DELEGATE(DelegateName, ReturnType, ...)                                                          \
@@ -33,4 +35,23 @@
 
 #ifndef NEKIRA_MULTI_DELEGATE
 #define NEKIRA_MULTI_DELEGATE(DelegateName, ...) using DelegateName = NekiraDelegate::MultiDelegate<__VA_ARGS__>;
+#endif
+
+#ifndef NEKIRA_SINGLE_THREAD_SINGLE_DELEGATE
+#define NEKIRA_SINGLE_THREAD_SINGLE_DELEGATE(DelegateName, ReturnType, ...)                                            \
+    using DelegateName = NekiraDelegate::SingleThreadDelegate<ReturnType, __VA_ARGS__>;
+#endif
+
+#ifndef NEKIRA_SINGLE_THREAD_MULTI_DELEGATE
+#define NEKIRA_SINGLE_THREAD_MULTI_DELEGATE(DelegateName, ...)                                                         \
+    using DelegateName = NekiraDelegate::SingleThreadMultiDelegate<__VA_ARGS__>;
+#endif
+
+#ifndef NEKIRA_ATOMIC_DELEGATE
+#define NEKIRA_ATOMIC_DELEGATE(DelegateName, ReturnType, ...)                                                          \
+    using DelegateName = NekiraDelegate::AtomicDelegate<ReturnType, __VA_ARGS__>;
+#endif
+
+#ifndef NEKIRA_STATIC_MULTI_DELEGATE
+#define NEKIRA_STATIC_MULTI_DELEGATE(DelegateName, ...) using DelegateName = NekiraDelegate::StaticMultiDelegate<__VA_ARGS__>;
 #endif
\ No newline at end of file
@@ -0,0 +1,187 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <NekiraDelegate/Core/Delegate.hpp>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+
+
+namespace NekiraDelegate
+{
+// 可观察属性，值发生变化时通过多播委托通知 (旧值, 新值)
+// 没有任何绑定时跳过比较与通知，只做赋值
+template <typename T, typename Comparator = std::equal_to<T>>
+class ObservableProperty final
+{
+public:
+    // 值变化的多播委托类型
+    using ChangedDelegate = MultiDelegate<const T&, const T&>;
+
+private:
+    // 当前值
+    T Value{};
+
+    // 值变化的多播委托
+    ChangedDelegate OnChanged;
+
+    // 判断两个值是否相等
+    [[no_unique_address]] Comparator Equal;
+
+    // 批量更新的嵌套深度
+    std::size_t UpdateDepth = 0;
+
+    // 批量更新开始后第一次修改前的旧值
+    std::optional<T> PendingOldValue;
+
+public:
+    ObservableProperty() = default;
+
+    explicit ObservableProperty(T InValue, Comparator InEqual = Comparator{})
+        : Value(std::move(InValue))
+        , Equal(std::move(InEqual))
+    {}
+
+    ~ObservableProperty() = default;
+
+    ObservableProperty(const ObservableProperty&) = delete;
+    ObservableProperty(ObservableProperty&&) noexcept = default;
+
+    ObservableProperty& operator=(const ObservableProperty&) = delete;
+    ObservableProperty& operator=(ObservableProperty&&) noexcept = default;
+
+    // 获取当前值
+    [[nodiscard]] const T& Get() const
+    {
+        return Value;
+    }
+
+    // 值变化的多播委托
+    ChangedDelegate& OnValueChanged()
+    {
+        return OnChanged;
+    }
+
+    // 设置新值，只有值真正变化时才通知
+    template <typename U>
+        requires std::is_assignable_v<T&, U&&>
+    void Set(U&& NewValue)
+    {
+        // 没有绑定时不需要比较
+        if (!OnChanged.IsValid())
+        {
+            Value = std::forward<U>(NewValue);
+            return;
+        }
+
+        // 批量更新中只记录第一次修改前的旧值
+        if (UpdateDepth > 0)
+        {
+            if (!PendingOldValue)
+            {
+                if (Equal(Value, NewValue))
+                {
+                    return;
+                }
+                PendingOldValue.emplace(std::move(Value));
+            }
+            Value = std::forward<U>(NewValue);
+            return;
+        }
+
+        if (Equal(Value, NewValue))
+        {
+            return;
+        }
+
+        T OldValue = std::move(Value);
+        Value      = std::forward<U>(NewValue);
+        OnChanged.Invoke(OldValue, Value);
+    }
+
+    // 开始批量更新，可以嵌套
+    void BeginUpdate()
+    {
+        ++UpdateDepth;
+    }
+
+    // 结束批量更新，最外层结束时若值发生变化则通知一次
+    void EndUpdate()
+    {
+        if (UpdateDepth == 0 || --UpdateDepth > 0)
+        {
+            return;
+        }
+
+        if (!PendingOldValue)
+        {
+            return;
+        }
+
+        T OldValue = std::move(*PendingOldValue);
+        PendingOldValue.reset();
+
+        if (OnChanged.IsValid() && !Equal(OldValue, Value))
+        {
+            OnChanged.Invoke(OldValue, Value);
+        }
+    }
+
+    // 是否处于批量更新中
+    [[nodiscard]] bool IsUpdating() const
+    {
+        return UpdateDepth > 0;
+    }
+
+    // 批量更新的作用域，析构时结束更新
+    class ScopedUpdate final
+    {
+    private:
+        ObservableProperty* Property;
+
+    public:
+        explicit ScopedUpdate(ObservableProperty& InProperty) : Property(&InProperty)
+        {
+            Property->BeginUpdate();
+        }
+
+        ~ScopedUpdate()
+        {
+            Property->EndUpdate();
+        }
+
+        ScopedUpdate(const ScopedUpdate&) = delete;
+        ScopedUpdate(ScopedUpdate&&) = delete;
+
+        ScopedUpdate& operator=(const ScopedUpdate&) = delete;
+        ScopedUpdate& operator=(ScopedUpdate&&) = delete;
+    };
+};
+} // namespace NekiraDelegate
@@ -0,0 +1,266 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <NekiraDelegate/Core/Delegate.hpp>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+
+
+namespace NekiraDelegate::Detail
+{
+// 静态监听者的函数指针萃取
+template <typename FuncType>
+struct StaticListenerTraits;
+
+// 普通函数
+template <typename RT, typename... Args>
+struct StaticListenerTraits<RT (*)(Args...)>
+{
+    using ArgsTuple    = std::tuple<Args...>;
+    using ReceiverType = std::nullptr_t;
+
+    static constexpr bool bIsMember = false;
+};
+
+// 普通成员函数
+template <typename RT, typename ClassType, typename... Args>
+struct StaticListenerTraits<RT (ClassType::*)(Args...)>
+{
+    using ArgsTuple    = std::tuple<Args...>;
+    using ReceiverType = ClassType*;
+
+    static constexpr bool bIsMember = true;
+};
+
+// const成员函数
+template <typename RT, typename ClassType, typename... Args>
+struct StaticListenerTraits<RT (ClassType::*)(Args...) const>
+{
+    using ArgsTuple    = std::tuple<Args...>;
+    using ReceiverType = const ClassType*;
+
+    static constexpr bool bIsMember = true;
+};
+
+// 在接收者列表中查找第一个可以转换为 Target 的对象下标，找不到时返回 sizeof...(Objects)
+template <typename Target, typename... Objects>
+consteval std::size_t FindReceiverIndex()
+{
+    constexpr bool Matches[] = {std::is_convertible_v<Objects*, Target>..., false};
+
+    for (std::size_t Index = 0; Index < sizeof...(Objects); ++Index)
+    {
+        if (Matches[Index])
+        {
+            return Index;
+        }
+    }
+    return sizeof...(Objects);
+}
+
+// 为单个监听者挑选接收者，普通函数不需要接收者
+template <auto Func, typename... Objects>
+constexpr auto PickReceiver(Objects*... InObjects)
+{
+    using Traits = StaticListenerTraits<decltype(Func)>;
+
+    if constexpr (!Traits::bIsMember)
+    {
+        return nullptr;
+    }
+    else
+    {
+        constexpr std::size_t Index = FindReceiverIndex<typename Traits::ReceiverType, Objects...>();
+        static_assert(Index < sizeof...(Objects), "StaticMultiDelegate: missing receiver object for member function");
+
+        return static_cast<typename Traits::ReceiverType>(std::get<Index>(std::tie(InObjects...)));
+    }
+}
+
+// 监听者能否以左值接收参数，不能时只能作为最后一个监听者并独占转发的参数
+template <auto Func, typename... Args>
+inline constexpr bool bListenerAcceptsLvalues =
+    StaticListenerTraits<decltype(Func)>::bIsMember
+        ? std::is_invocable_v<decltype(Func), typename StaticListenerTraits<decltype(Func)>::ReceiverType, Args&...>
+        : std::is_invocable_v<decltype(Func), Args&...>;
+} // namespace NekiraDelegate::Detail
+
+
+
+namespace NekiraDelegate
+{
+// 编译期静态多播委托的实现，监听者在编译期确定，派发函数完全内联
+// 不使用 ConnectionMap、shared_ptr 与 std::function，也没有每次调用的 Cleanup
+// 参数以左值依次传给前面的监听者，最后一个监听者(未绑定尾部委托时)或尾部委托获得转发的参数
+// 因此按值接收只可移动类型或接收右值引用的监听者只能放在最后，且此时不能绑定尾部委托
+// @[INFO] 成员函数的接收者以裸指针保存，不参与 IConnectionInterface 的自动解绑，需要保证其生命周期长于委托
+template <typename ArgsTuple, auto... Funcs>
+class StaticMultiDelegateImpl;
+
+template <typename... Args, auto... Funcs>
+class StaticMultiDelegateImpl<std::tuple<Args...>, Funcs...> final
+{
+private:
+    static_assert(sizeof...(Funcs) > 0, "StaticMultiDelegate: at least one listener is required");
+    static_assert((std::is_same_v<typename Detail::StaticListenerTraits<decltype(Funcs)>::ArgsTuple,
+                                  std::tuple<Args...>> && ...),
+                  "StaticMultiDelegate: all listeners must share the same signature");
+
+    static constexpr std::size_t ListenerCount = sizeof...(Funcs);
+
+    // 监听者列表，用于按下标取出监听者
+    static constexpr std::tuple<decltype(Funcs)...> Listeners{Funcs...};
+
+    // 最后一个监听者
+    static constexpr auto LastFunc = std::get<ListenerCount - 1>(Listeners);
+
+    template <std::size_t... Indices>
+    static consteval bool LeadingListenersAcceptLvalues(std::index_sequence<Indices...>)
+    {
+        return (Detail::bListenerAcceptsLvalues<std::get<Indices>(Listeners), Args...> && ...);
+    }
+
+    static_assert(LeadingListenersAcceptLvalues(std::make_index_sequence<ListenerCount - 1>{}),
+                  "StaticMultiDelegate: only the last listener may take move-only values or rvalue references");
+
+    // 每个监听者对应的接收者，普通函数为 nullptr_t
+    std::tuple<typename Detail::StaticListenerTraits<decltype(Funcs)>::ReceiverType...> Receivers;
+
+    // 运行时尾部委托，用于动态监听者
+    void* Tail = nullptr;
+
+    // 尾部委托的调用入口
+    void (*TailInvoker)(void*, Args&...) = nullptr;
+
+public:
+    // 按类型为成员函数匹配接收者，同一个类的多个成员函数共享同一个接收者
+    template <typename... Objects>
+    explicit StaticMultiDelegateImpl(Objects*... InObjects)
+        : Receivers(Detail::PickReceiver<Funcs>(InObjects...)...)
+    {}
+
+    ~StaticMultiDelegateImpl() = default;
+
+    StaticMultiDelegateImpl(const StaticMultiDelegateImpl&) = default;
+    StaticMultiDelegateImpl(StaticMultiDelegateImpl&&) noexcept = default;
+
+    StaticMultiDelegateImpl& operator=(const StaticMultiDelegateImpl&) = default;
+    StaticMultiDelegateImpl& operator=(StaticMultiDelegateImpl&&) noexcept = default;
+
+    // 是否有效，静态监听者始终存在
+    [[nodiscard]] constexpr bool IsValid() const
+    {
+        return true;
+    }
+
+    // 执行所有静态监听者，之后执行尾部委托
+    void Invoke(Args&&... args)
+    {
+        InvokeLeading(std::make_index_sequence<ListenerCount - 1>{}, args...);
+
+        auto& LastReceiver = std::get<ListenerCount - 1>(Receivers);
+
+        if constexpr (Detail::bListenerAcceptsLvalues<LastFunc, Args...>)
+        {
+            if (TailInvoker)
+            {
+                InvokeListener<LastFunc>(LastReceiver, args...);
+                TailInvoker(Tail, args...);
+                return;
+            }
+        }
+
+        InvokeListener<LastFunc>(LastReceiver, std::forward<Args>(args)...);
+    }
+
+    // 绑定运行时尾部委托，例如 MultiDelegate<Args...>，尾部委托的生命周期需要长于本委托
+    template <typename TailDelegate>
+        requires requires(TailDelegate& InTail, Args&&... args) {
+            { InTail.IsValid() } -> std::convertible_to<bool>;
+            InTail.Invoke(std::forward<Args>(args)...);
+        }
+    void BindTail(TailDelegate* InTail)
+    {
+        static_assert(Detail::bListenerAcceptsLvalues<LastFunc, Args...>,
+                      "StaticMultiDelegate: a tail cannot be bound when the last listener consumes its arguments");
+
+        if (!InTail)
+        {
+            RemoveTail();
+            return;
+        }
+
+        Tail        = InTail;
+        TailInvoker = [](void* InPtr, Args&... args)
+        {
+            auto* TailPtr = static_cast<TailDelegate*>(InPtr);
+            if (TailPtr->IsValid())
+            {
+                TailPtr->Invoke(std::forward<Args>(args)...);
+            }
+        };
+    }
+
+    // 移除尾部委托
+    void RemoveTail()
+    {
+        Tail        = nullptr;
+        TailInvoker = nullptr;
+    }
+
+private:
+    // 除最后一个之外的监听者，参数以左值传入，避免多次转发同一个右值
+    template <std::size_t... Indices>
+    void InvokeLeading(std::index_sequence<Indices...>, Args&... args)
+    {
+        (InvokeListener<std::get<Indices>(Listeners)>(std::get<Indices>(Receivers), args...), ...);
+    }
+
+    // 单个监听者的调用
+    template <auto Func, typename ReceiverType, typename... CallArgs>
+    static void InvokeListener(ReceiverType Receiver, CallArgs&&... args)
+    {
+        if constexpr (Detail::StaticListenerTraits<decltype(Func)>::bIsMember)
+        {
+            (Receiver->*Func)(std::forward<CallArgs>(args)...);
+        }
+        else
+        {
+            Func(std::forward<CallArgs>(args)...);
+        }
+    }
+};
+
+// 编译期静态多播委托，签名由第一个监听者推导
+template <auto FirstFunc, auto... OtherFuncs>
+using StaticMultiDelegate =
+    StaticMultiDelegateImpl<typename Detail::StaticListenerTraits<decltype(FirstFunc)>::ArgsTuple, FirstFunc,
+                            OtherFuncs...>;
+} // namespace NekiraDelegate
@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -53,15 +56,216 @@ public:
     virtual void Disconnect() = 0;
 };
 
+struct IntrusiveConnectionPolicy;
+
+// 单线程策略使用的连接器基类，在 ConnectionBase 之上携带侵入式引用计数
+// 引用计数只在该策略下存在，默认策略的连接器不为此付出额外的内存
+class IntrusiveConnectionBase : public ConnectionBase
+{
+private:
+    template <typename T>
+    friend class IntrusiveConnectionPtr;
+
+    friend struct IntrusiveConnectionPolicy;
+
+    // 侵入式引用计数，仅供 IntrusiveConnectionPtr 使用，非原子操作
+    mutable std::size_t IntrusiveRefCount{0};
+
+    // 批量分配时，同一批连接器共用第一个连接器的引用计数，为空表示使用自身的引用计数
+    const IntrusiveConnectionBase* IntrusiveRefOwner{nullptr};
+
+    // 引用计数归零时的释放函数，为空表示直接 delete
+    void (*IntrusiveDeleter)(const IntrusiveConnectionBase*){nullptr};
+
+public:
+    IntrusiveConnectionBase() = default;
+    ~IntrusiveConnectionBase() override = default;
+
+    // 引用计数与释放方式属于对象本身，拷贝与移动时不传递
+    IntrusiveConnectionBase(const IntrusiveConnectionBase&) noexcept
+    {}
+    IntrusiveConnectionBase(IntrusiveConnectionBase&&) noexcept
+    {}
+
+    IntrusiveConnectionBase& operator=(const IntrusiveConnectionBase&) noexcept
+    {
+        return *this;
+    }
+    IntrusiveConnectionBase& operator=(IntrusiveConnectionBase&&) noexcept
+    {
+        return *this;
+    }
+
+private:
+    // 实际持有引用计数的连接器
+    [[nodiscard]] const IntrusiveConnectionBase* GetIntrusiveRefOwner() const noexcept
+    {
+        return IntrusiveRefOwner ? IntrusiveRefOwner : this;
+    }
+
+    void AddIntrusiveRef() const noexcept
+    {
+        ++GetIntrusiveRefOwner()->IntrusiveRefCount;
+    }
+
+    void ReleaseIntrusiveRef() const noexcept
+    {
+        const auto* Owner = GetIntrusiveRefOwner();
+        if (--Owner->IntrusiveRefCount == 0)
+        {
+            if (Owner->IntrusiveDeleter)
+            {
+                Owner->IntrusiveDeleter(Owner);
+            }
+            else
+            {
+                delete Owner;
+            }
+        }
+    }
+};
+
 } // namespace NekiraDelegate
 
 
 namespace NekiraDelegate
 {
 
-// 模板连接器的默认实现
-template <typename RT, typename... Args>
-class Connection final : public ConnectionBase
+// 侵入式连接器指针，引用计数保存在 IntrusiveConnectionBase 中且为非原子操作
+// @[INFO] 只能在单线程中使用，不能跨线程拷贝或释放
+template <typename T>
+class IntrusiveConnectionPtr final
+{
+private:
+    template <typename U>
+    friend class IntrusiveConnectionPtr;
+
+    T* Ptr = nullptr;
+
+public:
+    IntrusiveConnectionPtr() = default;
+
+    IntrusiveConnectionPtr(std::nullptr_t) noexcept
+    {}
+
+    // 接管新创建的连接器
+    explicit IntrusiveConnectionPtr(T* InPtr) noexcept : Ptr(InPtr)
+    {
+        AddRef();
+    }
+
+    ~IntrusiveConnectionPtr()
+    {
+        Release();
+    }
+
+    IntrusiveConnectionPtr(const IntrusiveConnectionPtr& Other) noexcept : Ptr(Other.Ptr)
+    {
+        AddRef();
+    }
+
+    IntrusiveConnectionPtr(IntrusiveConnectionPtr&& Other) noexcept : Ptr(Other.Ptr)
+    {
+        Other.Ptr = nullptr;
+    }
+
+    // 派生连接器指针向基类指针的转换
+    template <typename U>
+        requires std::is_convertible_v<U*, T*>
+    IntrusiveConnectionPtr(const IntrusiveConnectionPtr<U>& Other) noexcept : Ptr(Other.Ptr)
+    {
+        AddRef();
+    }
+
+    template <typename U>
+        requires std::is_convertible_v<U*, T*>
+    IntrusiveConnectionPtr(IntrusiveConnectionPtr<U>&& Other) noexcept : Ptr(Other.Ptr)
+    {
+        Other.Ptr = nullptr;
+    }
+
+    IntrusiveConnectionPtr& operator=(const IntrusiveConnectionPtr& Other) noexcept
+    {
+        IntrusiveConnectionPtr(Other).swap(*this);
+        return *this;
+    }
+
+    IntrusiveConnectionPtr& operator=(IntrusiveConnectionPtr&& Other) noexcept
+    {
+        IntrusiveConnectionPtr(std::move(Other)).swap(*this);
+        return *this;
+    }
+
+    IntrusiveConnectionPtr& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    // 与 std::shared_ptr 保持一致的接口，便于在连接策略中统一使用
+    void reset() noexcept
+    {
+        Release();
+        Ptr = nullptr;
+    }
+
+    void swap(IntrusiveConnectionPtr& Other) noexcept
+    {
+        std::swap(Ptr, Other.Ptr);
+    }
+
+    [[nodiscard]] T* get() const noexcept
+    {
+        return Ptr;
+    }
+
+    [[nodiscard]] std::size_t use_count() const noexcept
+    {
+        return Ptr ? Ptr->GetIntrusiveRefOwner()->IntrusiveRefCount : 0;
+    }
+
+    T* operator->() const noexcept
+    {
+        return Ptr;
+    }
+
+    T& operator*() const noexcept
+    {
+        return *Ptr;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return Ptr != nullptr;
+    }
+
+private:
+    void AddRef() const noexcept
+    {
+        if (Ptr)
+        {
+            Ptr->AddIntrusiveRef();
+        }
+    }
+
+    void Release() noexcept
+    {
+        if (Ptr)
+        {
+            Ptr->ReleaseIntrusiveRef();
+        }
+    }
+};
+
+} // namespace NekiraDelegate
+
+
+namespace NekiraDelegate
+{
+
+// 模板连接器的默认实现，BaseType 由连接策略决定
+template <typename BaseType, typename RT, typename... Args>
+class BasicConnection final : public BaseType
 {
 private:
     // 使用 std::function 来存储连接的回调
@@ -72,17 +276,22 @@ private:
     bool bIsValidConnected {false};
 
 public:
-    Connection() = default;
-     ~Connection() override = default;
+    BasicConnection() = default;
+     ~BasicConnection() override = default;
 
-    explicit Connection(std::function<RT(Args...)> InCallback) : Callback(std::move(InCallback)), bIsValidConnected(true)
+    // 回调直接由函数对象构造，不经过临时的 std::function
+    template <typename Callable>
+        requires(!std::is_same_v<std::remove_cvref_t<Callable>, BasicConnection>
+                 && std::is_constructible_v<std::function<RT(Args...)>, Callable>)
+    explicit BasicConnection(Callable&& InCallback)
+        : Callback(std::forward<Callable>(InCallback)), bIsValidConnected(true)
     {}
 
-    Connection(const Connection&) = default;
-    Connection(Connection&&) noexcept = default;
+    BasicConnection(const BasicConnection&) = default;
+    BasicConnection(BasicConnection&&) noexcept = default;
 
-    Connection& operator=(const Connection&) = default;
-    Connection& operator=(Connection&&) noexcept = default;
+    BasicConnection& operator=(const BasicConnection&) = default;
+    BasicConnection& operator=(BasicConnection&&) noexcept = default;
 
     // 检查连接是否有效
     [[nodiscard]] bool IsValid() const override
@@ -104,8 +313,68 @@ public:
     }
 };
 
+// 默认策略的连接器
+template <typename RT, typename... Args>
+using Connection = BasicConnection<ConnectionBase, RT, Args...>;
+
+// 单线程策略的连接器
+template <typename RT, typename... Args>
+using IntrusiveConnection = BasicConnection<IntrusiveConnectionBase, RT, Args...>;
+
+} // namespace NekiraDelegate
+
+namespace NekiraDelegate
+{
+
+// 可跨线程使用的连接器，回调在构造后不再修改，有效标志为原子变量
+// 断开连接只清除有效标志，正在执行的调用不会受到影响
+// @[INFO] 断开连接不会等待正在执行的调用，成员函数的接收者必须在所有可能并发的调用结束之后才能析构
+template <typename RT, typename... Args>
+class AtomicConnection final : public ConnectionBase
+{
+private:
+    // 连接的回调，构造后只读
+    const std::function<RT(Args...)> Callback;
+
+    // 是否有效的标志
+    std::atomic<bool> bIsValidConnected{false};
+
+public:
+    explicit AtomicConnection(std::function<RT(Args...)> InCallback)
+        : Callback(std::move(InCallback))
+        , bIsValidConnected(Callback != nullptr)
+    {}
+
+    ~AtomicConnection() override = default;
+
+    AtomicConnection(const AtomicConnection&) = delete;
+    AtomicConnection(AtomicConnection&&) = delete;
+
+    AtomicConnection& operator=(const AtomicConnection&) = delete;
+    AtomicConnection& operator=(AtomicConnection&&) = delete;
+
+    // 检查连接是否有效
+    [[nodiscard]] bool IsValid() const override
+    {
+        return bIsValidConnected.load(std::memory_order_acquire);
+    }
+
+    // 断开连接
+    void Disconnect() override
+    {
+        bIsValidConnected.store(false, std::memory_order_release);
+    }
+
+    // 调用连接的回调
+    RT Invoke(Args&&... args) const
+    {
+        return IsValid() ? Callback(std::forward<Args>(args)...) : RT{};
+    }
+};
+
 } // namespace NekiraDelegate
 
+
 namespace NekiraDelegate
 {
 
@@ -116,20 +385,29 @@ private:
     // 存储连接的容器
     mutable std::vector<std::weak_ptr<ConnectionBase>> Connections;
 
+    using IntrusiveConnectionList = std::vector<IntrusiveConnectionPtr<IntrusiveConnectionBase>>;
+
+    // 单线程策略下存储连接的容器，持有侵入式引用以代替 weak_ptr 的追踪
+    // 首次添加单线程策略的连接时才创建，只使用默认策略的接收者只多占用一个空指针
+    mutable std::unique_ptr<IntrusiveConnectionList> IntrusiveConnections;
+
 public:
     IConnectionInterface() = default;
 
     virtual ~IConnectionInterface();
 
-    IConnectionInterface(const IConnectionInterface&) = default;
+    IConnectionInterface(const IConnectionInterface& Other);
     IConnectionInterface(IConnectionInterface&&) noexcept = default;
 
-    IConnectionInterface& operator=(const IConnectionInterface&) = default;
+    IConnectionInterface& operator=(const IConnectionInterface& Other);
     IConnectionInterface& operator=(IConnectionInterface&&) noexcept = default;
 
     // 添加连接.这里使用const是为了确保即便对象是const类型也能正常添加连接，对连接器的自动管理不受影响
     void AddConnection(std::shared_ptr<ConnectionBase> InConnection) const;
 
+    // 添加单线程策略下的连接
+    void AddConnection(IntrusiveConnectionPtr<IntrusiveConnectionBase> InConnection) const;
+
     // 断开所有连接.这里的const同上，确保即便对象是const类型也能正常断开连接
     void DisconnectAll() const;
 };
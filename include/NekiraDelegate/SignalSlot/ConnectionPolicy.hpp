@@ -0,0 +1,207 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <NekiraDelegate/SignalSlot/Connection.hpp>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+
+namespace NekiraDelegate::Detail
+{
+// 批量创建连接器时使用的分配器，allocate_shared 逐个构造数组元素时转交给 Constructor 就地构造
+// 元素按地址升序构造，Constructor 收到的下标即元素在批次中的位置
+template <typename T, typename ElementType, typename Constructor>
+struct BatchConnectionAllocator
+{
+    using value_type = T;
+
+    Constructor* Construct = nullptr;
+    std::size_t* NextIndex = nullptr;
+
+    BatchConnectionAllocator(Constructor* InConstruct, std::size_t* InNextIndex) noexcept
+        : Construct(InConstruct)
+        , NextIndex(InNextIndex)
+    {}
+
+    template <typename U>
+    BatchConnectionAllocator(const BatchConnectionAllocator<U, ElementType, Constructor>& Other) noexcept
+        : Construct(Other.Construct)
+        , NextIndex(Other.NextIndex)
+    {}
+
+    T* allocate(std::size_t Count)
+    {
+        return std::allocator<T>().allocate(Count);
+    }
+
+    void deallocate(T* Ptr, std::size_t Count) noexcept
+    {
+        std::allocator<T>().deallocate(Ptr, Count);
+    }
+
+    void construct(ElementType* Storage)
+    {
+        (*Construct)(Storage, (*NextIndex)++);
+    }
+
+    void destroy(ElementType* Storage) noexcept
+    {
+        std::destroy_at(Storage);
+    }
+
+    template <typename U>
+    bool operator==(const BatchConnectionAllocator<U, ElementType, Constructor>& Other) const noexcept
+    {
+        return Construct == Other.Construct;
+    }
+};
+} // namespace NekiraDelegate::Detail
+
+
+
+namespace NekiraDelegate
+{
+// 默认的连接策略：信号通过 std::shared_ptr 持有连接器，接收者通过 std::weak_ptr 追踪
+// 引用计数为原子操作，连接器可以在任意线程释放
+struct SharedConnectionPolicy final
+{
+    template <typename T>
+    using PtrType = std::shared_ptr<T>;
+
+    template <typename RT, typename... Args>
+    using ConnectionType = Connection<RT, Args...>;
+
+    template <typename T, typename... CtorArgs>
+    static PtrType<T> MakeConnection(CtorArgs&&... args)
+    {
+        return std::make_shared<T>(std::forward<CtorArgs>(args)...);
+    }
+
+    // 在一次分配中创建 Count 个连接器，第 Index 个连接器由 Construct(Storage, Index) 就地构造，之后依次交给 Consumer
+    // 所有连接器共享同一个控制块，全部释放后才回收内存
+    template <typename T, typename Constructor, typename Consumer>
+    static void MakeConnectionBatch(std::size_t Count, Constructor&& Construct, Consumer&& Func)
+    {
+        if (Count == 0)
+        {
+            return;
+        }
+
+        using ConstructorType = std::remove_reference_t<Constructor>;
+
+        std::size_t NextIndex = 0;
+
+        const auto Block = std::allocate_shared<T[]>(
+            Detail::BatchConnectionAllocator<T, T, ConstructorType>(std::addressof(Construct), &NextIndex), Count);
+
+        for (std::size_t Index = 0; Index < Count; ++Index)
+        {
+            Func(PtrType<T>(Block, &Block[Index]));
+        }
+    }
+};
+
+// 单线程连接策略：信号与接收者通过 IntrusiveConnectionPtr 持有连接器
+// 引用计数为非原子操作，避免多核下原子读改写带来的缓存行争用
+// @[INFO] 委托、接收者与所有连接都必须在同一个线程中使用
+struct IntrusiveConnectionPolicy final
+{
+    template <typename T>
+    using PtrType = IntrusiveConnectionPtr<T>;
+
+    template <typename RT, typename... Args>
+    using ConnectionType = IntrusiveConnection<RT, Args...>;
+
+    template <typename T, typename... CtorArgs>
+    static PtrType<T> MakeConnection(CtorArgs&&... args)
+    {
+        return PtrType<T>(new T(std::forward<CtorArgs>(args)...));
+    }
+
+    // 在一次分配中创建 Count 个连接器，第 Index 个连接器由 Construct(Storage, Index) 就地构造，之后依次交给 Consumer
+    // 所有连接器共用第一个连接器的引用计数，全部释放后才回收内存
+    template <typename T, typename Constructor, typename Consumer>
+    static void MakeConnectionBatch(std::size_t Count, Constructor&& Construct, Consumer&& Func)
+    {
+        if (Count == 0)
+        {
+            return;
+        }
+
+        static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned connections are not supported");
+
+        // 连接器数组之前保存数量，释放时据此逐个析构
+        constexpr std::size_t HeaderSize = (sizeof(std::size_t) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+        auto* Raw   = static_cast<std::byte*>(::operator new(HeaderSize + sizeof(T) * Count));
+        auto* Block = reinterpret_cast<T*>(Raw + HeaderSize);
+
+        std::size_t Constructed = 0;
+        try
+        {
+            for (; Constructed < Count; ++Constructed)
+            {
+                Construct(Block + Constructed, Constructed);
+            }
+        }
+        catch (...)
+        {
+            std::destroy_n(Block, Constructed);
+            ::operator delete(Raw);
+            throw;
+        }
+
+        std::construct_at(reinterpret_cast<std::size_t*>(Raw), Count);
+
+        Block[0].IntrusiveDeleter = [](const IntrusiveConnectionBase* Head)
+        {
+            auto* HeadBlock = const_cast<T*>(static_cast<const T*>(Head));
+            auto* HeadRaw   = reinterpret_cast<std::byte*>(HeadBlock) - HeaderSize;
+
+            std::destroy_n(HeadBlock, *std::launder(reinterpret_cast<std::size_t*>(HeadRaw)));
+            ::operator delete(HeadRaw);
+        };
+
+        for (std::size_t Index = 1; Index < Count; ++Index)
+        {
+            Block[Index].IntrusiveRefOwner = &Block[0];
+        }
+
+        // 保证 Consumer 抛出异常时整块内存也能被释放
+        const PtrType<T> Guard(Block);
+
+        for (std::size_t Index = 0; Index < Count; ++Index)
+        {
+            Func(PtrType<T>(&Block[Index]));
+        }
+    }
+};
+} // namespace NekiraDelegate
@@ -25,41 +25,52 @@
 #pragma once
 
 #include <NekiraDelegate/SignalSlot/Connection.hpp>
+#include <NekiraDelegate/SignalSlot/ConnectionPolicy.hpp>
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <ranges>
+#include <thread>
+#include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 
 
 namespace NekiraDelegate
 {
-// 单播信号类
-template <typename RT, typename... Args>
-class SingleSignal final
+// 单播信号类，Policy 决定连接器的持有方式
+template <typename Policy, typename RT, typename... Args>
+class BasicSingleSignal final
 {
 private:
+    using ConnectionType = typename Policy::template ConnectionType<RT, Args...>;
+
     // 当前连接器
-    std::shared_ptr<Connection<RT, Args...>> ConnectionPtr;
+    typename Policy::template PtrType<ConnectionType> ConnectionPtr;
 
 public:
-    SingleSignal() = default;
-    ~SingleSignal()
+    BasicSingleSignal() = default;
+    ~BasicSingleSignal()
     {
         Disconnect();
     }
 
-    SingleSignal(const SingleSignal&) = delete;
-    SingleSignal& operator=(const SingleSignal&) = delete;
+    BasicSingleSignal(const BasicSingleSignal&) = delete;
+    BasicSingleSignal& operator=(const BasicSingleSignal&) = delete;
 
-    SingleSignal(SingleSignal&& other) noexcept
+    BasicSingleSignal(BasicSingleSignal&& other) noexcept
         : ConnectionPtr(std::move(other.ConnectionPtr))
     {
         other.ConnectionPtr = nullptr;
     }
 
-    SingleSignal& operator=(SingleSignal&& other) noexcept
+    BasicSingleSignal& operator=(BasicSingleSignal&& other) noexcept
     {
         if (this != &other)
         {
@@ -96,7 +107,7 @@ public:
     void Connect(RT (*FuncPtr)(Args...))
     {
         std::function<RT(Args...)> Func = FuncPtr;
-        ConnectionPtr = std::make_shared<Connection<RT, Args...>>(std::move(Func));
+        Replace(Policy::template MakeConnection<ConnectionType>(std::move(Func)));
     }
 
     // 连接普通成员函数,要求继承 IConnectionInterface接口
@@ -109,7 +120,7 @@ public:
 
         std::function<RT(Args...)> Func = Lambda;
 
-        ConnectionPtr = std::make_shared<Connection<RT, Args...>>(std::move(Func));
+        Replace(Policy::template MakeConnection<ConnectionType>(std::move(Func)));
 
         // 添加连接到对象的连接接口
         static_cast<IConnectionInterface*>(Object)->AddConnection(ConnectionPtr);
@@ -125,7 +136,7 @@ public:
 
         std::function<RT(Args...)> Func = Lambda;
 
-        ConnectionPtr = std::make_shared<Connection<RT, Args...>>(std::move(Func));
+        Replace(Policy::template MakeConnection<ConnectionType>(std::move(Func)));
 
         // 添加连接到对象的连接接口
         static_cast<const IConnectionInterface*>(Object)->AddConnection(ConnectionPtr);
@@ -138,10 +149,27 @@ public:
     {
         std::function<RT(Args...)> Func = std::forward<Callable>(CallableObj);
 
-        ConnectionPtr = std::make_shared<Connection<RT, Args...>>(std::move(Func));
+        Replace(Policy::template MakeConnection<ConnectionType>(std::move(Func)));
+    }
+
+private:
+    // 替换当前连接器，旧连接器先被断开
+    // 接收者可能仍持有旧连接器的引用，断开后它才会在接收者清理时被释放
+    void Replace(typename Policy::template PtrType<ConnectionType> NewConnection)
+    {
+        Disconnect();
+        ConnectionPtr = std::move(NewConnection);
     }
 };
 
+// 默认策略的单播信号
+template <typename RT, typename... Args>
+using SingleSignal = BasicSingleSignal<SharedConnectionPolicy, RT, Args...>;
+
+// 单线程策略的单播信号
+template <typename RT, typename... Args>
+using SingleThreadSingleSignal = BasicSingleSignal<IntrusiveConnectionPolicy, RT, Args...>;
+
 } // namespace NekiraDelegate
 
 
@@ -179,48 +207,103 @@ struct MultiSignalHandle final
     void*       SignalPtr; // 指向多播信号的指针
     std::size_t Id;        // 连接的唯一标识符
 };
+
+// 多播信号中连接的分组标记，用于按组批量断开
+// 推荐通过 Allocate 获取全局唯一的分组，手动指定的标识符需要调用者自行保证不与其他模块冲突
+struct MultiSignalGroup final
+{
+    MultiSignalGroup() = default;
+    ~MultiSignalGroup() = default;
+
+    explicit MultiSignalGroup(std::size_t InId)
+        : Id(InId)
+    {
+    }
+
+    MultiSignalGroup(const MultiSignalGroup&) = default;
+    MultiSignalGroup(MultiSignalGroup&&) = default;
+
+    MultiSignalGroup& operator=(const MultiSignalGroup&) = default;
+    MultiSignalGroup& operator=(MultiSignalGroup&&) = default;
+
+    bool operator==(const MultiSignalGroup& Other) const
+    {
+        return Id == Other.Id;
+    }
+
+    bool operator!=(const MultiSignalGroup& Other) const
+    {
+        return !(*this == Other);
+    }
+
+    // 分配一个全局唯一的分组，可在任意线程调用
+    // 分配的标识符位于最高位为1的区间，不会与手动指定的较小标识符冲突
+    [[nodiscard]] static MultiSignalGroup Allocate();
+
+    std::size_t Id = 0; // 分组标识符，0 表示不属于任何分组
+};
 } // namespace NekiraDelegate
 
 
 namespace NekiraDelegate
 {
 
-// 多播信号类
-template <typename... Args>
-class MultiSignal final
+// 多播信号类，Policy 决定连接器的持有方式
+template <typename Policy, typename... Args>
+class BasicMultiSignal final
 {
 private:
-    using ConnectionType = Connection<void, Args...>;
-    using ConnectionPair = std::pair<MultiSignalHandle, std::shared_ptr<ConnectionType>>;
+    using ConnectionType    = typename Policy::template ConnectionType<void, Args...>;
+    using ConnectionPtrType = typename Policy::template PtrType<ConnectionType>;
+
+    // 连接槽，记录句柄、所属接收者与连接器
+    struct ConnectionSlot
+    {
+        MultiSignalHandle Handle;
+        const void*       Owner = nullptr; // 所属接收者，为空表示没有接收者
+        MultiSignalGroup  Group;           // 所属分组
+        ConnectionPtrType ConnectionPtr;
+    };
+
+    // 接收者索引中的一项，连接器由 ConnectionMap 中的连接槽持有
+    using ReceiverEntry = std::pair<std::size_t, ConnectionType*>;
 
     // 存储连接器
-    std::vector<ConnectionPair> ConnectionMap;
+    std::vector<ConnectionSlot> ConnectionMap;
+
+    // 接收者到其连接的索引，用于按接收者批量断开
+    std::unordered_map<const void*, std::vector<ReceiverEntry>> ReceiverIndex;
+
+    // 清理时收集的含有无效连接的接收者，复用以避免每次清理都分配内存
+    std::vector<const void*> StaleOwners;
 
     std::size_t NextId = 0; // 用于生成唯一的连接ID
 
 public:
-    MultiSignal() = default;
-    ~MultiSignal()
+    BasicMultiSignal() = default;
+    ~BasicMultiSignal()
     {
         DisconnectAll();
     }
 
-    MultiSignal(const MultiSignal&) = delete;
-    MultiSignal& operator=(const MultiSignal&) = delete;
+    BasicMultiSignal(const BasicMultiSignal&) = delete;
+    BasicMultiSignal& operator=(const BasicMultiSignal&) = delete;
 
-    MultiSignal(MultiSignal&& other) noexcept
+    BasicMultiSignal(BasicMultiSignal&& other) noexcept
         : ConnectionMap(std::move(other.ConnectionMap))
+        , ReceiverIndex(std::move(other.ReceiverIndex))
         , NextId(other.NextId)
     {
         other.NextId = 0;
     }
 
-    MultiSignal& operator=(MultiSignal&& other) noexcept
+    BasicMultiSignal& operator=(BasicMultiSignal&& other) noexcept
     {
         if (this != &other)
         {
             DisconnectAll();
             ConnectionMap = std::move(other.ConnectionMap);
+            ReceiverIndex = std::move(other.ReceiverIndex);
             NextId        = other.NextId;
             other.NextId  = 0;
         }
@@ -228,10 +311,12 @@ public:
     }
 
 
-    // 是否有效
+    // 是否有效，存在至少一个有效连接时为真
+    // 已断开但尚未清理的连接槽不计入，通常第一个连接槽即有效，只需检查一次
     [[nodiscard]] bool IsValid() const
     {
-        return !ConnectionMap.empty();
+        return std::any_of(ConnectionMap.begin(), ConnectionMap.end(), [](const ConnectionSlot& Slot)
+                           { return Slot.ConnectionPtr && Slot.ConnectionPtr->IsValid(); });
     }
 
     // 执行所有连接的回调
@@ -240,130 +325,612 @@ public:
         // 清理无效连接
         Cleanup();
 
-        for (auto& Pair : ConnectionMap)
+        for (auto& Slot : ConnectionMap)
         {
-            Pair.second->Invoke(std::forward<Args>(args)...);
+            Slot.ConnectionPtr->Invoke(std::forward<Args>(args)...);
         }
     }
 
     // 断开特定连接
     void DisconnectSingle(const MultiSignalHandle& Handle)
     {
-        const auto It = std::remove_if(ConnectionMap.begin(), ConnectionMap.end(),
-                                       [&Handle](const ConnectionPair& Pair) { return Pair.first == Handle; });
+        // 句柄ID唯一，找到后直接移除该连接槽
+        const auto It = std::find_if(ConnectionMap.begin(), ConnectionMap.end(),
+                                     [&Handle](const ConnectionSlot& Slot) { return Slot.Handle == Handle; });
 
         if (It != ConnectionMap.end())
         {
-            if (It->second)
+            if (It->ConnectionPtr)
+            {
+                It->ConnectionPtr->Disconnect();
+            }
+            RemoveFromIndex(*It);
+            ConnectionMap.erase(It);
+        }
+    }
+
+    // 断开某个接收者的所有连接，开销只与该接收者的连接数相关
+    // 连接器会被立即断开，IsValid 随即不再计入这些连接，ConnectionMap 中的连接槽在下一次 Invoke 时被清理
+    void DisconnectAllFor(const void* Owner)
+    {
+        const auto It = ReceiverIndex.find(Owner);
+        if (It == ReceiverIndex.end())
+        {
+            return;
+        }
+
+        for (const auto& Entry : It->second)
+        {
+            Entry.second->Disconnect();
+        }
+
+        ReceiverIndex.erase(It);
+    }
+
+    // 断开某个分组的所有连接，并与其他无效连接一起在一次压缩中移除
+    void DisconnectGroup(const MultiSignalGroup& Group)
+    {
+        if (Group.Id == 0)
+        {
+            return;
+        }
+
+        for (auto& Slot : ConnectionMap)
+        {
+            if (Slot.Group == Group && Slot.ConnectionPtr)
             {
-                It->second->Disconnect();
+                Slot.ConnectionPtr->Disconnect();
             }
-            ConnectionMap.erase(It, ConnectionMap.end());
         }
+
+        Cleanup();
+    }
+
+    // 预留连接槽的容量
+    void Reserve(std::size_t Count)
+    {
+        ConnectionMap.reserve(Count);
     }
 
     // 断开所有连接
     void DisconnectAll()
     {
-        for (auto& Pair : ConnectionMap)
+        for (auto& Slot : ConnectionMap)
         {
-            if (Pair.second)
+            if (Slot.ConnectionPtr)
             {
-                Pair.second->Disconnect();
+                Slot.ConnectionPtr->Disconnect();
             }
         }
 
         ConnectionMap.clear();
+        ReceiverIndex.clear();
     }
 
     // 连接普通函数
-    MultiSignalHandle Connect(void (*FuncPtr)(Args...))
+    MultiSignalHandle Connect(void (*FuncPtr)(Args...), const MultiSignalGroup& Group = {})
     {
         std::function<void(Args...)> Func = FuncPtr;
-        auto                         NewConnection = std::make_shared<ConnectionType>(std::move(Func));
-
-        MultiSignalHandle Handler{this, ++NextId};
-
-        ConnectionPair Pair{Handler, std::move(NewConnection)};
-
-        ConnectionMap.push_back(std::move(Pair));
 
-        return Handler;
+        return AddConnection(Policy::template MakeConnection<ConnectionType>(std::move(Func)), nullptr, Group);
     }
 
     // 连接普通成员函数,要求继承 IConnectionInterface接口
     template <typename ClassType>
         requires std::is_base_of_v<IConnectionInterface, ClassType>
-    MultiSignalHandle Connect(ClassType* Object, void (ClassType::*FuncPtr)(Args...))
+    MultiSignalHandle Connect(ClassType* Object, void (ClassType::*FuncPtr)(Args...),
+                              const MultiSignalGroup& Group = {})
     {
         auto Lambda = [Object, FuncPtr](Args&&... args) { (Object->*FuncPtr)(std::forward<Args>(args)...); };
 
         std::function<void(Args...)> Func = Lambda;
 
-        auto NewConnection = std::make_shared<ConnectionType>(std::move(Func));
+        auto NewConnection = Policy::template MakeConnection<ConnectionType>(std::move(Func));
 
         // 添加连接到对象的连接接口
-        static_cast<IConnectionInterface*>(Object)->AddConnection(NewConnection);
-
-        MultiSignalHandle Handler{this, ++NextId};
+        const auto* Receiver = static_cast<IConnectionInterface*>(Object);
+        Receiver->AddConnection(NewConnection);
 
-        ConnectionPair Pair{Handler, std::move(NewConnection)};
-
-        ConnectionMap.push_back(std::move(Pair));
-
-        return Handler;
+        return AddConnection(std::move(NewConnection), Receiver, Group);
     }
 
     // 连接const成员函数,要求继承 IConnectionInterface接口
     template <typename ClassType>
         requires std::is_base_of_v<IConnectionInterface, ClassType>
-    MultiSignalHandle Connect(const ClassType* Object, void (ClassType::*FuncPtr)(Args...) const)
+    MultiSignalHandle Connect(const ClassType* Object, void (ClassType::*FuncPtr)(Args...) const,
+                              const MultiSignalGroup& Group = {})
     {
         auto Lambda = [Object, FuncPtr](Args&&... args) { (Object->*FuncPtr)(std::forward<Args>(args)...); };
 
         std::function<void(Args...)> Func = Lambda;
 
-        auto NewConnection = std::make_shared<ConnectionType>(std::move(Func));
+        auto NewConnection = Policy::template MakeConnection<ConnectionType>(std::move(Func));
 
         // 添加连接到对象的连接接口
-        static_cast<const IConnectionInterface*>(Object)->AddConnection(NewConnection);
+        const auto* Receiver = static_cast<const IConnectionInterface*>(Object);
+        Receiver->AddConnection(NewConnection);
 
-        MultiSignalHandle Handler{this, ++NextId};
-
-        ConnectionPair Pair{Handler, std::move(NewConnection)};
+        return AddConnection(std::move(NewConnection), Receiver, Group);
+    }
 
-        ConnectionMap.push_back(std::move(Pair));
+    // 连接函数对象、lambda表达式
+    template <typename Callable>
+        requires std::is_invocable_r_v<void, Callable, Args...>
+    MultiSignalHandle Connect(Callable&& CallableObj, const MultiSignalGroup& Group = {})
+    {
+        std::function<void(Args...)> Func = std::forward<Callable>(CallableObj);
 
-        return Handler;
+        return AddConnection(Policy::template MakeConnection<ConnectionType>(std::move(Func)), nullptr, Group);
     }
 
-    // 连接函数对象、lambda表达式
+    // 连接函数对象、lambda表达式，并记录所属者，之后可以通过 DisconnectAllFor(Owner) 批量断开
     template <typename Callable>
         requires std::is_invocable_r_v<void, Callable, Args...>
-    MultiSignalHandle Connect(Callable&& CallableObj)
+    MultiSignalHandle Connect(const void* Owner, Callable&& CallableObj, const MultiSignalGroup& Group = {})
     {
         std::function<void(Args...)> Func = std::forward<Callable>(CallableObj);
 
-        auto NewConnection = std::make_shared<ConnectionType>(std::move(Func));
+        return AddConnection(Policy::template MakeConnection<ConnectionType>(std::move(Func)), Owner, Group);
+    }
+
+    // 批量连接一组函数对象，所有连接器在一次分配中创建
+    template <typename Range>
+        requires std::ranges::sized_range<Range>
+                 && std::is_invocable_r_v<void, std::ranges::range_reference_t<Range>, Args...>
+    std::vector<MultiSignalHandle> ConnectRange(Range&& Callables, const MultiSignalGroup& Group = {})
+    {
+        const auto Count = static_cast<std::size_t>(std::ranges::size(Callables));
+
+        std::vector<MultiSignalHandle> Handles;
+        Handles.reserve(Count);
+
+        ReserveForBatch(Count);
+
+        auto It = std::ranges::begin(Callables);
+
+        Policy::template MakeConnectionBatch<ConnectionType>(
+            Count,
+            [&It](ConnectionType* Storage, std::size_t)
+            {
+                // 右值范围中的函数对象可以被移动
+                if constexpr (std::is_lvalue_reference_v<Range>)
+                {
+                    std::construct_at(Storage, *It);
+                }
+                else
+                {
+                    std::construct_at(Storage, std::move(*It));
+                }
+                ++It;
+            },
+            [this, &Handles, &Group](ConnectionPtrType NewConnection)
+            { Handles.push_back(AddConnection(std::move(NewConnection), nullptr, Group)); });
+
+        return Handles;
+    }
+
+    // 批量连接多个函数对象，所有连接器在一次分配中创建，并直接由对应的函数对象就地构造
+    template <typename... Callables>
+        requires(sizeof...(Callables) > 0 && (std::is_invocable_r_v<void, Callables, Args...> && ...))
+    std::vector<MultiSignalHandle> ConnectMany(const MultiSignalGroup& Group, Callables&&... Funcs)
+    {
+        constexpr std::size_t Count = sizeof...(Callables);
+
+        std::vector<MultiSignalHandle> Handles;
+        Handles.reserve(Count);
 
+        ReserveForBatch(Count);
+
+        auto CallableRefs = std::forward_as_tuple(std::forward<Callables>(Funcs)...);
+
+        Policy::template MakeConnectionBatch<ConnectionType>(
+            Count,
+            [&CallableRefs](ConnectionType* Storage, std::size_t Index)
+            { ConstructAt(Storage, Index, std::move(CallableRefs), std::make_index_sequence<Count>{}); },
+            [this, &Handles, &Group](ConnectionPtrType NewConnection)
+            { Handles.push_back(AddConnection(std::move(NewConnection), nullptr, Group)); });
+
+        return Handles;
+    }
+
+private:
+    // 用第 Index 个函数对象就地构造连接器，每个下标只会被构造一次，因此每个函数对象只被转发一次
+    template <typename CallableTuple, std::size_t... Indices>
+    static void ConstructAt(ConnectionType* Storage, std::size_t Index, CallableTuple&& Callables,
+                            std::index_sequence<Indices...>)
+    {
+        ((Index == Indices ? (std::construct_at(Storage, std::get<Indices>(std::move(Callables))), void()) : void()),
+         ...);
+    }
+
+    // 为批量连接预留连接槽，保持几何增长，避免多次小批量连接时反复扩容
+    void ReserveForBatch(std::size_t Count)
+    {
+        const auto Required = ConnectionMap.size() + Count;
+        if (Required > ConnectionMap.capacity())
+        {
+            ConnectionMap.reserve(std::max(Required, ConnectionMap.capacity() * 2));
+        }
+    }
+
+    // 添加连接槽，并在有所属者时登记到接收者索引
+    MultiSignalHandle AddConnection(ConnectionPtrType NewConnection, const void* Owner, const MultiSignalGroup& Group)
+    {
         MultiSignalHandle Handler{this, ++NextId};
 
-        ConnectionPair Pair{Handler, std::move(NewConnection)};
+        if (Owner)
+        {
+            ReceiverIndex[Owner].emplace_back(Handler.Id, NewConnection.get());
+        }
 
-        ConnectionMap.push_back(std::move(Pair));
+        ConnectionMap.push_back(ConnectionSlot{Handler, Owner, Group, std::move(NewConnection)});
 
         return Handler;
     }
 
-private:
+    // 从接收者索引中移除连接槽
+    void RemoveFromIndex(const ConnectionSlot& Slot)
+    {
+        if (!Slot.Owner)
+        {
+            return;
+        }
+
+        const auto It = ReceiverIndex.find(Slot.Owner);
+        if (It == ReceiverIndex.end())
+        {
+            return;
+        }
+
+        auto&      Entries = It->second;
+        const auto EntryIt = std::find_if(Entries.begin(), Entries.end(),
+                                          [&Slot](const ReceiverEntry& Entry) { return Entry.first == Slot.Handle.Id; });
+
+        if (EntryIt != Entries.end())
+        {
+            *EntryIt = Entries.back();
+            Entries.pop_back();
+        }
+
+        if (Entries.empty())
+        {
+            ReceiverIndex.erase(It);
+        }
+    }
+
+    // 清理接收者索引中已经断开的连接，每个接收者只遍历一次
+    // 必须在连接槽被移除之前调用，此时索引中的连接器仍然有效
+    void PruneStaleOwners()
+    {
+        std::sort(StaleOwners.begin(), StaleOwners.end(), std::less<>{});
+        StaleOwners.erase(std::unique(StaleOwners.begin(), StaleOwners.end()), StaleOwners.end());
+
+        for (const void* Owner : StaleOwners)
+        {
+            const auto It = ReceiverIndex.find(Owner);
+            if (It == ReceiverIndex.end())
+            {
+                continue;
+            }
+
+            std::erase_if(It->second, [](const ReceiverEntry& Entry) { return !Entry.second->IsValid(); });
+
+            if (It->second.empty())
+            {
+                ReceiverIndex.erase(It);
+            }
+        }
+
+        StaleOwners.clear();
+    }
+
     // 清理无效的连接
     void Cleanup()
     {
-        const auto It = std::remove_if(ConnectionMap.begin(), ConnectionMap.end(),
-                                       [](const auto& Pair) { return !Pair.second || !Pair.second->IsValid(); });
+        bool bHasInvalid = false;
+
+        for (const auto& Slot : ConnectionMap)
+        {
+            if (!Slot.ConnectionPtr || !Slot.ConnectionPtr->IsValid())
+            {
+                bHasInvalid = true;
+                if (Slot.Owner)
+                {
+                    StaleOwners.push_back(Slot.Owner);
+                }
+            }
+        }
+
+        if (!bHasInvalid)
+        {
+            return;
+        }
+
+        PruneStaleOwners();
+
+        const auto It = std::remove_if(ConnectionMap.begin(), ConnectionMap.end(), [](const ConnectionSlot& Slot)
+                                       { return !Slot.ConnectionPtr || !Slot.ConnectionPtr->IsValid(); });
 
         ConnectionMap.erase(It, ConnectionMap.end());
     }
 };
 
-} // namespace NekiraDelegate
\ No newline at end of file
+// 默认策略的多播信号
+template <typename... Args>
+using MultiSignal = BasicMultiSignal<SharedConnectionPolicy, Args...>;
+
+// 单线程策略的多播信号
+template <typename... Args>
+using SingleThreadMultiSignal = BasicMultiSignal<IntrusiveConnectionPolicy, Args...>;
+
+} // namespace NekiraDelegate
+
+
+namespace NekiraDelegate::Detail
+{
+// 当前线程的读者序号，首次调用时按顺序分配，用于把读者分散到不同的计数器分片
+inline std::size_t GetReaderThreadSlot() noexcept
+{
+    static std::atomic<std::size_t> NextSlot{0};
+
+    thread_local const std::size_t Slot = NextSlot.fetch_add(1, std::memory_order_relaxed);
+    return Slot;
+}
+} // namespace NekiraDelegate::Detail
+
+
+namespace NekiraDelegate
+{
+// 可并发重新绑定的单播信号
+// 读者(Invoke)无等待、不加锁、不分配内存，也不修改连接器的引用计数，回调在读者登记期间执行
+// 读者按版本登记在两组计数器中 (Left-Right 读者登记方式)，每组按线程分片且每个分片独占缓存行
+// 线程数不超过分片数时，不同线程的读者不会争用同一个计数器
+// 写者(Connect/Disconnect)互斥且从不等待读者，被替换的连接器先放入退役列表
+// 写者每次替换时尝试切换读者版本，旧版本的读者全部退出后，之前退役的连接器才被释放
+// 因此回调中可以重新绑定或断开自身所在的信号，退役的连接器会在之后的某次替换或信号析构时释放
+// @[INFO] 接收者的自动解绑只清除连接的有效标志，不等待正在执行的回调，接收者必须在所有并发的 Invoke 结束后才能析构
+// @[INFO] IConnectionInterface 不是线程安全的，同一个接收者的绑定与析构不能在多个线程中并发进行
+template <typename RT, typename... Args>
+class AtomicSingleSignal final
+{
+private:
+    using ConnectionType = AtomicConnection<RT, Args...>;
+
+    static constexpr std::size_t CacheLineSize = 64;
+
+    // 每组读者计数器的分片数量，线程数不超过分片数时读者之间没有争用
+    static constexpr std::size_t ReaderShardCount = 8;
+
+    static_assert((ReaderShardCount & (ReaderShardCount - 1)) == 0, "ReaderShardCount must be a power of two");
+
+    // 读者计数器，独占缓存行以避免分片之间的伪共享
+    struct alignas(CacheLineSize) ReaderCounter
+    {
+        std::atomic<std::size_t> Count{0};
+    };
+
+    // 已被替换、可能仍被读者使用的连接器
+    struct RetiredConnection
+    {
+        std::shared_ptr<ConnectionType> ConnectionPtr;
+        std::uint64_t                   RetireToggle = 0; // 退役时读者版本已经切换的次数
+    };
+
+    // 读者登记，析构时退出
+    class ReadScope final
+    {
+    private:
+        ReaderCounter& Counter;
+
+    public:
+        explicit ReadScope(const AtomicSingleSignal& Signal)
+            : Counter(Signal.Readers[Signal.ReaderVersion.load()]
+                                    [Detail::GetReaderThreadSlot() & (ReaderShardCount - 1)])
+        {
+            Counter.Count.fetch_add(1);
+        }
+
+        ~ReadScope()
+        {
+            Counter.Count.fetch_sub(1);
+        }
+
+        ReadScope(const ReadScope&) = delete;
+        ReadScope& operator=(const ReadScope&) = delete;
+    };
+
+    // 两个版本的读者计数器
+    mutable ReaderCounter Readers[2][ReaderShardCount];
+
+    // 当前的读者版本
+    std::atomic<std::size_t> ReaderVersion{0};
+
+    // 读者看到的当前连接器
+    std::atomic<ConnectionType*> CurrentConnection{nullptr};
+
+    // 写者持有的当前连接器，保证 CurrentConnection 指向的对象有效
+    std::shared_ptr<ConnectionType> ConnectionPtr;
+
+    // 退役列表，按退役顺序排列，由写者持有直到读者全部退出
+    std::vector<RetiredConnection> RetiredConnections;
+
+    // 读者版本切换的次数
+    std::uint64_t ToggleCount = 0;
+
+    // 已确认旧版本读者全部退出的切换次数
+    std::uint64_t DrainedToggleCount = 0;
+
+    // 写者互斥锁
+    std::mutex WriterMutex;
+
+public:
+    AtomicSingleSignal() = default;
+
+    // 析构时不能再有其他线程调用，退役列表中的连接器随之释放
+    ~AtomicSingleSignal()
+    {
+        Disconnect();
+    }
+
+    AtomicSingleSignal(const AtomicSingleSignal&) = delete;
+    AtomicSingleSignal& operator=(const AtomicSingleSignal&) = delete;
+
+    AtomicSingleSignal(AtomicSingleSignal&&) = delete;
+    AtomicSingleSignal& operator=(AtomicSingleSignal&&) = delete;
+
+    // 是否有效的连接
+    [[nodiscard]] bool IsValid() const
+    {
+        const ReadScope Scope(*this);
+
+        const auto* Current = CurrentConnection.load();
+        return Current && Current->IsValid();
+    }
+
+    // 执行连接的回调，可以与重新绑定并发执行，回调中也可以重新绑定或断开本信号
+    RT Invoke(Args&&... args) const
+    {
+        const ReadScope Scope(*this);
+
+        const auto* Current = CurrentConnection.load();
+        return Current ? Current->Invoke(std::forward<Args>(args)...) : RT{};
+    }
+
+    // 断开连接
+    void Disconnect()
+    {
+        Replace(nullptr);
+    }
+
+    // 连接普通函数
+    void Connect(RT (*FuncPtr)(Args...))
+    {
+        std::function<RT(Args...)> Func = FuncPtr;
+        Replace(std::make_shared<ConnectionType>(std::move(Func)));
+    }
+
+    // 连接普通成员函数,要求继承 IConnectionInterface接口
+    template <typename ClassType>
+        requires std::is_base_of_v<IConnectionInterface, ClassType>
+    void Connect(ClassType* Object, RT (ClassType::*FuncPtr)(Args...))
+    {
+        auto Lambda = [Object, FuncPtr](Args&&... args) -> RT
+        { return (Object->*FuncPtr)(std::forward<Args>(args)...); };
+
+        std::function<RT(Args...)> Func = Lambda;
+
+        auto NewConnection = std::make_shared<ConnectionType>(std::move(Func));
+
+        // 添加连接到对象的连接接口
+        static_cast<IConnectionInterface*>(Object)->AddConnection(NewConnection);
+
+        Replace(std::move(NewConnection));
+    }
+
+    // 连接const成员函数,要求继承 IConnectionInterface接口
+    template <typename ClassType>
+        requires std::is_base_of_v<IConnectionInterface, ClassType>
+    void Connect(const ClassType* Object, RT (ClassType::*FuncPtr)(Args...) const)
+    {
+        auto Lambda = [Object, FuncPtr](Args&&... args) -> RT
+        { return (Object->*FuncPtr)(std::forward<Args>(args)...); };
+
+        std::function<RT(Args...)> Func = Lambda;
+
+        auto NewConnection = std::make_shared<ConnectionType>(std::move(Func));
+
+        // 添加连接到对象的连接接口
+        static_cast<const IConnectionInterface*>(Object)->AddConnection(NewConnection);
+
+        Replace(std::move(NewConnection));
+    }
+
+    // 连接函数对象、lambda表达式
+    template <typename Callable>
+        requires std::is_invocable_r_v<RT, Callable, Args...>
+    void Connect(Callable&& CallableObj)
+    {
+        std::function<RT(Args...)> Func = std::forward<Callable>(CallableObj);
+
+        Replace(std::make_shared<ConnectionType>(std::move(Func)));
+    }
+
+private:
+    // 替换当前连接器，旧连接器放入退役列表，写者不等待读者
+    void Replace(std::shared_ptr<ConnectionType> NewConnection)
+    {
+        // 可以释放的连接器在锁释放之后再销毁，回调捕获的对象析构时可能再次访问本信号
+        std::vector<RetiredConnection> Reclaimed;
+
+        const std::lock_guard<std::mutex> Lock(WriterMutex);
+
+        CurrentConnection.store(NewConnection.get());
+        auto Retired = std::exchange(ConnectionPtr, std::move(NewConnection));
+
+        if (Retired)
+        {
+            RetiredConnections.push_back({std::move(Retired), ToggleCount});
+        }
+
+        TryAdvanceReaderVersion();
+        CollectReclaimable(Reclaimed);
+    }
+
+    // 某个版本的读者是否已经全部退出
+    [[nodiscard]] bool IsDrained(std::size_t Version) const
+    {
+        for (const auto& Counter : Readers[Version])
+        {
+            if (Counter.Count.load() != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 在不等待的前提下尝试切换读者版本
+    // 旧版本的读者全部退出时，之前切换之前退役的连接器都已不再被读者使用
+    void TryAdvanceReaderVersion()
+    {
+        const auto Version = ReaderVersion.load();
+
+        // 切换前必须重新确认另一个版本为空，其中可能有在切换前读取了版本号的读者
+        if (!IsDrained(Version ^ 1))
+        {
+            return;
+        }
+        DrainedToggleCount = ToggleCount;
+
+        // 最近一次切换之后没有新的退役连接器，不需要再次切换
+        if (RetiredConnections.empty() || RetiredConnections.back().RetireToggle < ToggleCount)
+        {
+            return;
+        }
+
+        ReaderVersion.store(Version ^ 1);
+        ++ToggleCount;
+
+        if (IsDrained(Version))
+        {
+            DrainedToggleCount = ToggleCount;
+        }
+    }
+
+    // 取出所有已经不会被读者使用的退役连接器
+    void CollectReclaimable(std::vector<RetiredConnection>& Reclaimed)
+    {
+        const auto It = std::find_if(RetiredConnections.begin(), RetiredConnections.end(),
+                                     [this](const RetiredConnection& Retired)
+                                     { return Retired.RetireToggle >= DrainedToggleCount; });
+
+        if (It == RetiredConnections.begin())
+        {
+            return;
+        }
+
+        Reclaimed.assign(std::make_move_iterator(RetiredConnections.begin()), std::make_move_iterator(It));
+        RetiredConnections.erase(RetiredConnections.begin(), It);
+    }
+};
+} // namespace NekiraDelegate
@@ -0,0 +1,270 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#pragma once
+
+#include <NekiraDelegate/Core/Delegate.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+
+
+namespace NekiraDelegate
+{
+// 用于取消或查询定时器
+struct TimerHandle final
+{
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    TimerHandle() = default;
+    ~TimerHandle() = default;
+
+    TimerHandle(std::uint32_t InIndex, std::uint32_t InGeneration)
+        : Index(InIndex)
+        , Generation(InGeneration)
+    {
+    }
+
+    TimerHandle(const TimerHandle&) = default;
+    TimerHandle(TimerHandle&&) = default;
+
+    TimerHandle& operator=(const TimerHandle&) = default;
+    TimerHandle& operator=(TimerHandle&&) = default;
+
+    bool operator==(const TimerHandle& Other) const
+    {
+        return Index == Other.Index && Generation == Other.Generation;
+    }
+
+    bool operator!=(const TimerHandle& Other) const
+    {
+        return !(*this == Other);
+    }
+
+    std::uint32_t Index      = InvalidIndex; // 定时器节点下标
+    std::uint32_t Generation = 0;            // 节点的复用代数，防止旧句柄误操作新定时器
+};
+} // namespace NekiraDelegate
+
+
+
+namespace NekiraDelegate
+{
+// 分层时间轮，调度与取消均为 O(1)，支持一次性与重复定时器
+// 定时器到期时执行绑定的 Delegate<void> 或 MultiDelegate<>，由调用者驱动 Tick
+// @[INFO] 绑定 IConnectionInterface 接收者的定时器会在接收者销毁后失效，并在下一次到期时被移除
+class TimerWheel final
+{
+public:
+    // 时间单位
+    using Duration = std::chrono::nanoseconds;
+
+    // 时钟，返回单调递增的当前时间
+    using ClockFunc = std::function<Duration()>;
+
+    static constexpr std::uint32_t LevelBits  = 8;
+    static constexpr std::uint32_t SlotCount  = 1u << LevelBits;
+    static constexpr std::uint32_t SlotMask   = SlotCount - 1;
+    static constexpr std::uint32_t LevelCount = 4;
+
+private:
+    // 空闲节点持有 std::monostate，释放与创建节点时不需要为委托分配内存
+    using PayloadType = std::variant<std::monostate, Delegate<void>, MultiDelegate<>>;
+
+    // 定时器节点的状态
+    enum class TimerState : std::uint8_t
+    {
+        Free,      // 空闲，位于空闲链表中
+        Pending,   // 等待到期，位于时间轮的槽中
+        Running,   // 正在执行回调
+        Cancelled, // 在回调执行期间被取消
+    };
+
+    // 定时器节点，通过下标组成侵入式双向链表
+    struct TimerNode
+    {
+        PayloadType   Payload;
+        std::uint64_t ExpireTick   = 0;
+        std::uint64_t IntervalTick = 0; // 为0表示一次性定时器
+        std::uint32_t Prev         = TimerHandle::InvalidIndex;
+        std::uint32_t Next         = TimerHandle::InvalidIndex;
+        std::uint32_t ListId       = TimerHandle::InvalidIndex;
+        std::uint32_t Generation   = 0;
+        TimerState    State        = TimerState::Free;
+    };
+
+    // 每个槽对应一条链表，最后一条链表存放本次 Tick 到期的定时器
+    static constexpr std::uint32_t ExpiringListId = LevelCount * SlotCount;
+
+    // 时间轮能直接表示的最大间隔
+    static constexpr std::uint64_t MaxTickSpan = (std::uint64_t{1} << (LevelBits * LevelCount)) - 1;
+
+    // 定时器节点池
+    std::vector<TimerNode> Nodes;
+
+    // 各条链表的头节点
+    std::array<std::uint32_t, ExpiringListId + 1> ListHeads;
+
+    // 空闲节点链表头
+    std::uint32_t FreeHead = TimerHandle::InvalidIndex;
+
+    // 下一个要处理的 Tick
+    std::uint64_t CurrentTick = 0;
+
+    // 等待中的定时器数量
+    std::size_t ActiveCount = 0;
+
+    // 每个 Tick 的时长
+    Duration TickInterval;
+
+    // 时钟与起始时间
+    ClockFunc Clock;
+    Duration  StartTime;
+
+public:
+    // 默认使用 std::chrono::steady_clock
+    explicit TimerWheel(Duration InTickInterval = std::chrono::milliseconds(1), ClockFunc InClock = {});
+    ~TimerWheel() = default;
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    TimerWheel(TimerWheel&&) noexcept = default;
+    TimerWheel& operator=(TimerWheel&&) noexcept = default;
+
+    // 调度一次性定时器
+    TimerHandle ScheduleOnce(Duration Delay, Delegate<void> Payload);
+    TimerHandle ScheduleOnce(Duration Delay, MultiDelegate<> Payload);
+
+    // 调度重复定时器
+    TimerHandle ScheduleRepeating(Duration Interval, Delegate<void> Payload);
+    TimerHandle ScheduleRepeating(Duration Interval, MultiDelegate<> Payload);
+
+    // 调度一次性定时器，绑定成员函数,要求继承 IConnectionInterface接口
+    template <typename ClassType>
+        requires std::is_base_of_v<IConnectionInterface, ClassType>
+    TimerHandle ScheduleOnce(Duration Delay, ClassType* Object, void (ClassType::*FuncPtr)())
+    {
+        Delegate<void> Payload;
+        Payload.BindMemberFunction(Object, FuncPtr);
+        return ScheduleOnce(Delay, std::move(Payload));
+    }
+
+    // 调度重复定时器，绑定成员函数,要求继承 IConnectionInterface接口
+    template <typename ClassType>
+        requires std::is_base_of_v<IConnectionInterface, ClassType>
+    TimerHandle ScheduleRepeating(Duration Interval, ClassType* Object, void (ClassType::*FuncPtr)())
+    {
+        Delegate<void> Payload;
+        Payload.BindMemberFunction(Object, FuncPtr);
+        return ScheduleRepeating(Interval, std::move(Payload));
+    }
+
+    // 调度一次性定时器，绑定函数对象、lambda表达式
+    template <typename Callable>
+        requires std::is_invocable_r_v<void, Callable>
+    TimerHandle ScheduleOnce(Duration Delay, Callable&& Func)
+    {
+        Delegate<void> Payload;
+        Payload.BindFunctionObject(std::forward<Callable>(Func));
+        return ScheduleOnce(Delay, std::move(Payload));
+    }
+
+    // 调度重复定时器，绑定函数对象、lambda表达式
+    template <typename Callable>
+        requires std::is_invocable_r_v<void, Callable>
+    TimerHandle ScheduleRepeating(Duration Interval, Callable&& Func)
+    {
+        Delegate<void> Payload;
+        Payload.BindFunctionObject(std::forward<Callable>(Func));
+        return ScheduleRepeating(Interval, std::move(Payload));
+    }
+
+    // 取消定时器，回调中取消自身也是安全的
+    bool Cancel(const TimerHandle& Handle);
+
+    // 取消所有定时器
+    void CancelAll();
+
+    // 定时器是否仍在等待
+    [[nodiscard]] bool IsActive(const TimerHandle& Handle) const;
+
+    // 等待中的定时器数量
+    [[nodiscard]] std::size_t Size() const
+    {
+        return ActiveCount;
+    }
+
+    // 已经处理的 Tick 数
+    [[nodiscard]] std::uint64_t GetCurrentTick() const
+    {
+        return CurrentTick;
+    }
+
+    // 读取时钟并推进到当前时间，返回执行的回调数量
+    std::size_t Tick();
+
+    // 手动推进指定的 Tick 数，返回执行的回调数量
+    std::size_t Advance(std::uint64_t Ticks);
+
+private:
+    // 将时长转换为 Tick 数，至少为1
+    [[nodiscard]] std::uint64_t ToTicks(Duration InDuration) const;
+
+    // 分配节点并放入时间轮
+    TimerHandle ScheduleTimer(std::uint64_t DelayTicks, std::uint64_t IntervalTicks, PayloadType&& Payload);
+
+    // 按到期时间将节点放入对应的槽
+    void InsertNode(std::uint32_t Index);
+
+    // 将节点挂到链表头部
+    void LinkNode(std::uint32_t Index, std::uint32_t ListId);
+
+    // 从所在链表中摘除节点
+    void UnlinkNode(std::uint32_t Index);
+
+    // 释放节点到空闲链表
+    void FreeNode(std::uint32_t Index);
+
+    // 将高层槽中的定时器重新分配到低层
+    void Cascade(std::uint32_t Level, std::uint32_t Slot);
+
+    // 处理一个 Tick，返回执行的回调数量
+    std::size_t ProcessTick();
+
+    // 执行定时器的回调
+    static void InvokePayload(PayloadType& Payload);
+
+    // 回调是否仍然有效
+    [[nodiscard]] static bool IsPayloadValid(const PayloadType& Payload);
+};
+} // namespace NekiraDelegate
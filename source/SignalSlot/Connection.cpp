@@ -33,6 +33,26 @@ IConnectionInterface::~IConnectionInterface()
     DisconnectAll();
 }
 
+// 拷贝时与默认策略的连接一样复制对单线程策略连接的追踪
+IConnectionInterface::IConnectionInterface(const IConnectionInterface& Other)
+    : Connections(Other.Connections)
+    , IntrusiveConnections(Other.IntrusiveConnections
+                               ? std::make_unique<IntrusiveConnectionList>(*Other.IntrusiveConnections)
+                               : nullptr)
+{}
+
+IConnectionInterface& IConnectionInterface::operator=(const IConnectionInterface& Other)
+{
+    if (this != &Other)
+    {
+        Connections          = Other.Connections;
+        IntrusiveConnections = Other.IntrusiveConnections
+                                   ? std::make_unique<IntrusiveConnectionList>(*Other.IntrusiveConnections)
+                                   : nullptr;
+    }
+    return *this;
+}
+
 // 添加连接
 void IConnectionInterface::AddConnection(std::shared_ptr<ConnectionBase> InConnection) const
 {
@@ -42,6 +62,29 @@ void IConnectionInterface::AddConnection(std::shared_ptr<ConnectionBase> InConne
     }
 }
 
+// 添加单线程策略下的连接
+void IConnectionInterface::AddConnection(IntrusiveConnectionPtr<IntrusiveConnectionBase> InConnection) const
+{
+    if (!InConnection || !InConnection->IsValid())
+    {
+        return;
+    }
+
+    if (!IntrusiveConnections)
+    {
+        IntrusiveConnections = std::make_unique<IntrusiveConnectionList>();
+    }
+
+    // 容器需要扩容时先移除已经断开的连接，避免持有的引用无限增长
+    auto& List = *IntrusiveConnections;
+    if (List.size() == List.capacity())
+    {
+        std::erase_if(List, [](const auto& Ptr) { return !Ptr->IsValid(); });
+    }
+
+    List.push_back(std::move(InConnection));
+}
+
 // 断开所有连接
 void IConnectionInterface::DisconnectAll() const
 {
@@ -54,6 +97,16 @@ void IConnectionInterface::DisconnectAll() const
     }
 
     Connections.clear();
+
+    if (IntrusiveConnections)
+    {
+        for (const auto& Ptr : *IntrusiveConnections)
+        {
+            Ptr->Disconnect();
+        }
+
+        IntrusiveConnections.reset();
+    }
 }
 
 } // namespace NekiraDelegate
\ No newline at end of file
@@ -0,0 +1,399 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <TimerWheel.hpp>
+#include <algorithm>
+
+namespace NekiraDelegate
+{
+
+TimerWheel::TimerWheel(Duration InTickInterval, ClockFunc InClock)
+    : TickInterval(std::max(InTickInterval, Duration{1}))
+    , Clock(std::move(InClock))
+{
+    if (!Clock)
+    {
+        Clock = []
+        { return std::chrono::duration_cast<Duration>(std::chrono::steady_clock::now().time_since_epoch()); };
+    }
+
+    ListHeads.fill(TimerHandle::InvalidIndex);
+    StartTime = Clock();
+}
+
+TimerHandle TimerWheel::ScheduleOnce(Duration Delay, Delegate<void> Payload)
+{
+    return ScheduleTimer(ToTicks(Delay), 0, PayloadType{std::move(Payload)});
+}
+
+TimerHandle TimerWheel::ScheduleOnce(Duration Delay, MultiDelegate<> Payload)
+{
+    return ScheduleTimer(ToTicks(Delay), 0, PayloadType{std::move(Payload)});
+}
+
+TimerHandle TimerWheel::ScheduleRepeating(Duration Interval, Delegate<void> Payload)
+{
+    const auto IntervalTicks = ToTicks(Interval);
+    return ScheduleTimer(IntervalTicks, IntervalTicks, PayloadType{std::move(Payload)});
+}
+
+TimerHandle TimerWheel::ScheduleRepeating(Duration Interval, MultiDelegate<> Payload)
+{
+    const auto IntervalTicks = ToTicks(Interval);
+    return ScheduleTimer(IntervalTicks, IntervalTicks, PayloadType{std::move(Payload)});
+}
+
+// 取消定时器
+bool TimerWheel::Cancel(const TimerHandle& Handle)
+{
+    if (!IsActive(Handle))
+    {
+        return false;
+    }
+
+    auto& Node = Nodes[Handle.Index];
+
+    // 回调正在执行，等回调结束后再释放节点
+    if (Node.State == TimerState::Running)
+    {
+        Node.State = TimerState::Cancelled;
+        --ActiveCount;
+        return true;
+    }
+
+    UnlinkNode(Handle.Index);
+    FreeNode(Handle.Index);
+    --ActiveCount;
+    return true;
+}
+
+// 取消所有定时器
+void TimerWheel::CancelAll()
+{
+    for (std::uint32_t Index = 0; Index < Nodes.size(); ++Index)
+    {
+        if (Nodes[Index].State == TimerState::Pending)
+        {
+            UnlinkNode(Index);
+            FreeNode(Index);
+        }
+        else if (Nodes[Index].State == TimerState::Running)
+        {
+            Nodes[Index].State = TimerState::Cancelled;
+        }
+    }
+
+    ActiveCount = 0;
+}
+
+// 定时器是否仍在等待
+bool TimerWheel::IsActive(const TimerHandle& Handle) const
+{
+    if (Handle.Index >= Nodes.size())
+    {
+        return false;
+    }
+
+    const auto& Node = Nodes[Handle.Index];
+    return Node.Generation == Handle.Generation
+           && (Node.State == TimerState::Pending || Node.State == TimerState::Running);
+}
+
+// 读取时钟并推进到当前时间
+std::size_t TimerWheel::Tick()
+{
+    const auto Elapsed = Clock() - StartTime;
+    if (Elapsed.count() <= 0)
+    {
+        return 0;
+    }
+
+    const auto TargetTick = static_cast<std::uint64_t>(Elapsed / TickInterval);
+
+    return TargetTick > CurrentTick ? Advance(TargetTick - CurrentTick) : 0;
+}
+
+// 手动推进指定的 Tick 数
+std::size_t TimerWheel::Advance(std::uint64_t Ticks)
+{
+    std::size_t FiredCount = 0;
+
+    while (Ticks > 0)
+    {
+        // 没有等待中的定时器时直接跳过剩余的 Tick
+        if (ActiveCount == 0)
+        {
+            CurrentTick += Ticks;
+            break;
+        }
+
+        FiredCount += ProcessTick();
+        --Ticks;
+    }
+
+    return FiredCount;
+}
+
+// 将时长转换为 Tick 数，向上取整
+std::uint64_t TimerWheel::ToTicks(Duration InDuration) const
+{
+    if (InDuration <= TickInterval)
+    {
+        return 1;
+    }
+
+    return static_cast<std::uint64_t>((InDuration + TickInterval - Duration{1}) / TickInterval);
+}
+
+// 分配节点并放入时间轮
+TimerHandle TimerWheel::ScheduleTimer(std::uint64_t DelayTicks, std::uint64_t IntervalTicks, PayloadType&& Payload)
+{
+    std::uint32_t Index = FreeHead;
+
+    if (Index != TimerHandle::InvalidIndex)
+    {
+        FreeHead = Nodes[Index].Next;
+    }
+    else
+    {
+        Index = static_cast<std::uint32_t>(Nodes.size());
+        Nodes.emplace_back();
+    }
+
+    auto& Node        = Nodes[Index];
+    Node.Payload      = std::move(Payload);
+    Node.ExpireTick   = CurrentTick + DelayTicks - 1;
+    Node.IntervalTick = IntervalTicks;
+    Node.State        = TimerState::Pending;
+
+    InsertNode(Index);
+    ++ActiveCount;
+
+    return TimerHandle{Index, Node.Generation};
+}
+
+// 按到期时间将节点放入对应的槽
+void TimerWheel::InsertNode(std::uint32_t Index)
+{
+    auto& Node = Nodes[Index];
+
+    const auto ExpireTick = std::max(Node.ExpireTick, CurrentTick);
+    const auto Delta      = std::min(ExpireTick - CurrentTick, MaxTickSpan);
+    const auto SlotTick   = CurrentTick + Delta;
+
+    std::uint32_t Level = 0;
+    while (Level + 1 < LevelCount && Delta >= (std::uint64_t{1} << (LevelBits * (Level + 1))))
+    {
+        ++Level;
+    }
+
+    const auto Slot = static_cast<std::uint32_t>((SlotTick >> (LevelBits * Level)) & SlotMask);
+
+    LinkNode(Index, Level * SlotCount + Slot);
+}
+
+// 将节点挂到链表头部
+void TimerWheel::LinkNode(std::uint32_t Index, std::uint32_t ListId)
+{
+    auto& Node = Nodes[Index];
+
+    Node.ListId = ListId;
+    Node.Prev   = TimerHandle::InvalidIndex;
+    Node.Next   = ListHeads[ListId];
+
+    if (Node.Next != TimerHandle::InvalidIndex)
+    {
+        Nodes[Node.Next].Prev = Index;
+    }
+
+    ListHeads[ListId] = Index;
+}
+
+// 从所在链表中摘除节点
+void TimerWheel::UnlinkNode(std::uint32_t Index)
+{
+    auto& Node = Nodes[Index];
+
+    if (Node.Prev != TimerHandle::InvalidIndex)
+    {
+        Nodes[Node.Prev].Next = Node.Next;
+    }
+    else
+    {
+        ListHeads[Node.ListId] = Node.Next;
+    }
+
+    if (Node.Next != TimerHandle::InvalidIndex)
+    {
+        Nodes[Node.Next].Prev = Node.Prev;
+    }
+
+    Node.Prev   = TimerHandle::InvalidIndex;
+    Node.Next   = TimerHandle::InvalidIndex;
+    Node.ListId = TimerHandle::InvalidIndex;
+}
+
+// 释放节点到空闲链表
+void TimerWheel::FreeNode(std::uint32_t Index)
+{
+    auto& Node = Nodes[Index];
+
+    Node.Payload.emplace<std::monostate>();
+    Node.State   = TimerState::Free;
+    ++Node.Generation;
+
+    Node.Next = FreeHead;
+    FreeHead  = Index;
+}
+
+// 将高层槽中的定时器重新分配到低层
+void TimerWheel::Cascade(std::uint32_t Level, std::uint32_t Slot)
+{
+    const auto ListId = Level * SlotCount + Slot;
+
+    std::uint32_t Index = ListHeads[ListId];
+    ListHeads[ListId]   = TimerHandle::InvalidIndex;
+
+    while (Index != TimerHandle::InvalidIndex)
+    {
+        const auto Next = Nodes[Index].Next;
+        InsertNode(Index);
+        Index = Next;
+    }
+}
+
+// 处理一个 Tick
+std::size_t TimerWheel::ProcessTick()
+{
+    const auto ProcessingTick = CurrentTick;
+    const auto Slot           = static_cast<std::uint32_t>(ProcessingTick & SlotMask);
+
+    // 低层转完一圈时，从高层依次向下分配
+    if (Slot == 0)
+    {
+        for (std::uint32_t Level = 1; Level < LevelCount; ++Level)
+        {
+            const auto LevelSlot = static_cast<std::uint32_t>((ProcessingTick >> (LevelBits * Level)) & SlotMask);
+            Cascade(Level, LevelSlot);
+
+            if (LevelSlot != 0)
+            {
+                break;
+            }
+        }
+    }
+
+    // 将到期的槽整体移入到期链表，回调中新增的定时器不会进入本次处理
+    std::uint32_t Index       = ListHeads[Slot];
+    ListHeads[Slot]           = TimerHandle::InvalidIndex;
+    ListHeads[ExpiringListId] = Index;
+
+    while (Index != TimerHandle::InvalidIndex)
+    {
+        Nodes[Index].ListId = ExpiringListId;
+        Index               = Nodes[Index].Next;
+    }
+
+    ++CurrentTick;
+
+    std::size_t FiredCount = 0;
+
+    while (ListHeads[ExpiringListId] != TimerHandle::InvalidIndex)
+    {
+        const auto Current = ListHeads[ExpiringListId];
+        UnlinkNode(Current);
+
+        // 超出时间轮范围的定时器在此重新放回
+        if (Nodes[Current].ExpireTick > ProcessingTick)
+        {
+            InsertNode(Current);
+            continue;
+        }
+
+        // 回调中可能调度新的定时器导致节点池扩容，因此先取出回调
+        PayloadType Payload  = std::move(Nodes[Current].Payload);
+        Nodes[Current].State = TimerState::Running;
+
+        if (IsPayloadValid(Payload))
+        {
+            InvokePayload(Payload);
+            ++FiredCount;
+        }
+
+        auto& Node = Nodes[Current];
+
+        if (Node.State == TimerState::Running && Node.IntervalTick > 0 && IsPayloadValid(Payload))
+        {
+            Node.Payload    = std::move(Payload);
+            Node.ExpireTick = ProcessingTick + Node.IntervalTick;
+            Node.State      = TimerState::Pending;
+            InsertNode(Current);
+            continue;
+        }
+
+        // 已取消的定时器在 Cancel 时已经计数
+        if (Node.State == TimerState::Running)
+        {
+            --ActiveCount;
+        }
+        FreeNode(Current);
+    }
+
+    return FiredCount;
+}
+
+// 执行定时器的回调
+void TimerWheel::InvokePayload(PayloadType& Payload)
+{
+    std::visit(
+        [](auto& Target)
+        {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(Target)>, std::monostate>)
+            {
+                Target.Invoke();
+            }
+        },
+        Payload);
+}
+
+// 回调是否仍然有效
+bool TimerWheel::IsPayloadValid(const PayloadType& Payload)
+{
+    return std::visit(
+        [](const auto& Target)
+        {
+            if constexpr (std::is_same_v<std::decay_t<decltype(Target)>, std::monostate>)
+            {
+                return false;
+            }
+            else
+            {
+                return Target.IsValid();
+            }
+        },
+        Payload);
+}
+
+} // namespace NekiraDelegate
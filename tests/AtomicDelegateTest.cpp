@@ -0,0 +1,180 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraDelegate/Core/AtomicDelegate.hpp>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+int FailureCount = 0;
+
+#define NEKIRA_CHECK(Condition)                                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(Condition))                                                                                              \
+        {                                                                                                              \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition);                        \
+            ++FailureCount;                                                                                            \
+        }                                                                                                              \
+    } while (false)
+
+// 回调中重新绑定自身所在的委托，被替换的回调在执行结束前保持有效
+void TestRebindFromCallback()
+{
+    NekiraDelegate::AtomicDelegate<int, int> Delegate;
+
+    const std::string Tag = "first";
+
+    Delegate.BindFunctionObject(
+        [&Delegate, Tag](int Value)
+        {
+            Delegate.BindFunctionObject([](int InValue) { return InValue * 2; });
+
+            // 重新绑定之后仍然可以访问旧回调捕获的状态
+            return static_cast<int>(Tag.size()) + Value;
+        });
+
+    NEKIRA_CHECK(Delegate.Invoke(1) == 6);
+    NEKIRA_CHECK(Delegate.Invoke(3) == 6);
+}
+
+// 回调中断开自身所在的委托
+void TestDisconnectFromCallback()
+{
+    NekiraDelegate::AtomicDelegate<void> Delegate;
+
+    int CallCount = 0;
+
+    Delegate.BindFunctionObject(
+        [&Delegate, &CallCount]()
+        {
+            ++CallCount;
+            Delegate.RemoveBinding();
+        });
+
+    Delegate.Invoke();
+    Delegate.Invoke();
+
+    NEKIRA_CHECK(CallCount == 1);
+    NEKIRA_CHECK(!Delegate.IsValid());
+}
+
+// 多个线程并发调用，回调与其他线程同时重新绑定委托
+void TestConcurrentRebindFromCallback()
+{
+    NekiraDelegate::AtomicDelegate<void> Delegate;
+
+    std::atomic<int>  CallCount{0};
+    std::atomic<bool> bStop{false};
+
+    // 回调读取按值捕获的状态，连接器被提前释放时会读到已销毁的对象
+    const auto Rebind = [&Delegate, &CallCount]()
+    {
+        Delegate.BindFunctionObject(
+            [&Delegate, &CallCount, Tag = std::string(32, 'a')]()
+            {
+                CallCount.fetch_add(static_cast<int>(Tag.size() / 32));
+                Delegate.BindFunctionObject([&CallCount, Tag]()
+                                            { CallCount.fetch_add(static_cast<int>(Tag.size() / 32)); });
+            });
+    };
+
+    Rebind();
+
+    std::vector<std::thread> Invokers;
+    for (int Index = 0; Index < 4; ++Index)
+    {
+        Invokers.emplace_back(
+            [&Delegate, &bStop]()
+            {
+                while (!bStop.load())
+                {
+                    Delegate.Invoke();
+                }
+            });
+    }
+
+    // 至少重新绑定一定次数，并等待调用线程真正开始执行
+    for (int Round = 0; Round < 2000 || CallCount.load() < 1000; ++Round)
+    {
+        Rebind();
+    }
+
+    bStop.store(true);
+    for (auto& Invoker : Invokers)
+    {
+        Invoker.join();
+    }
+
+    NEKIRA_CHECK(Delegate.IsValid());
+}
+
+// 退役的连接器在之后的替换中被释放，不会无限累积
+void TestRetiredConnectionsReleased()
+{
+    NekiraDelegate::AtomicDelegate<void> Delegate;
+
+    const auto Token = std::make_shared<int>(0);
+
+    for (int Round = 0; Round < 100; ++Round)
+    {
+        Delegate.BindFunctionObject([Token]() {});
+    }
+
+    // 没有读者时，退役的连接器在替换时立即释放
+    NEKIRA_CHECK(Token.use_count() == 2);
+
+    // 回调中重新绑定时旧连接器仍在使用，之后的替换会释放它
+    Delegate.BindFunctionObject([&Delegate, Token]() { Delegate.BindFunctionObject([Token]() {}); });
+    Delegate.Invoke();
+    Delegate.BindFunctionObject([]() {});
+    Delegate.BindFunctionObject([]() {});
+
+    NEKIRA_CHECK(Token.use_count() == 1);
+}
+
+#undef NEKIRA_CHECK
+} // namespace
+
+
+int main()
+{
+    TestRebindFromCallback();
+    TestDisconnectFromCallback();
+    TestConcurrentRebindFromCallback();
+    TestRetiredConnectionsReleased();
+
+    if (FailureCount != 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", FailureCount);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,197 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 TokiraNeo (https://github.com/TokiraNeo)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <NekiraDelegate/Timer/TimerWheel.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+
+namespace
+{
+int FailureCount = 0;
+
+#define NEKIRA_CHECK(Condition)                                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (!(Condition))                                                                                              \
+        {                                                                                                              \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #Condition);                        \
+            ++FailureCount;                                                                                            \
+        }                                                                                                              \
+    } while (false)
+
+using NekiraDelegate::TimerHandle;
+using NekiraDelegate::TimerWheel;
+using Ticks = std::chrono::milliseconds;
+
+// 使用固定时钟，只通过 Advance 推进，每个 Tick 为 1 毫秒
+TimerWheel MakeWheel()
+{
+    return TimerWheel(Ticks(1), [] { return TimerWheel::Duration{0}; });
+}
+
+// 各层边界附近的延迟都在预期的 Tick 到期，包括起点不对齐的情况
+void TestCascadeBoundaries()
+{
+    const std::vector<std::uint64_t> Delays = {1, 255, 256, 257, 65535, 65536, 65537, 16777216};
+
+    for (const std::uint64_t Offset : {std::uint64_t{0}, std::uint64_t{100}, std::uint64_t{65500}})
+    {
+        auto Wheel = MakeWheel();
+        Wheel.Advance(Offset);
+
+        std::vector<std::uint64_t> FiredTicks(Delays.size(), 0);
+
+        for (std::size_t Index = 0; Index < Delays.size(); ++Index)
+        {
+            Wheel.ScheduleOnce(Ticks(Delays[Index]),
+                               [&Wheel, &FiredTicks, Index] { FiredTicks[Index] = Wheel.GetCurrentTick(); });
+        }
+
+        // 用一个远期定时器保持时间轮不为空，避免空闲时整体跳过 Tick
+        const auto Keeper = Wheel.ScheduleOnce(Ticks(Delays.back() + 10), [] {});
+
+        Wheel.Advance(Delays.back() + 1);
+
+        for (std::size_t Index = 0; Index < Delays.size(); ++Index)
+        {
+            NEKIRA_CHECK(FiredTicks[Index] == Offset + Delays[Index]);
+        }
+
+        NEKIRA_CHECK(Wheel.Cancel(Keeper));
+        NEKIRA_CHECK(Wheel.Size() == 0);
+    }
+}
+
+// 重复定时器按间隔持续触发
+void TestRepeatingTimer()
+{
+    auto Wheel = MakeWheel();
+
+    std::vector<std::uint64_t> FiredTicks;
+
+    const auto Handle =
+        Wheel.ScheduleRepeating(Ticks(3), [&Wheel, &FiredTicks] { FiredTicks.push_back(Wheel.GetCurrentTick()); });
+
+    NEKIRA_CHECK(Wheel.Advance(300) == 100);
+    NEKIRA_CHECK(FiredTicks.size() == 100);
+    NEKIRA_CHECK(!FiredTicks.empty() && FiredTicks.front() == 3 && FiredTicks.back() == 300);
+    NEKIRA_CHECK(Wheel.IsActive(Handle));
+
+    NEKIRA_CHECK(Wheel.Cancel(Handle));
+    NEKIRA_CHECK(!Wheel.IsActive(Handle));
+    NEKIRA_CHECK(Wheel.Advance(10) == 0);
+}
+
+// 回调中取消自身，一次性与重复定时器都只计数一次
+void TestSelfCancel()
+{
+    auto Wheel = MakeWheel();
+
+    int         RepeatCount = 0;
+    TimerHandle RepeatHandle;
+    RepeatHandle = Wheel.ScheduleRepeating(Ticks(2),
+                                           [&Wheel, &RepeatCount, &RepeatHandle]
+                                           {
+                                               if (++RepeatCount == 3)
+                                               {
+                                                   NEKIRA_CHECK(Wheel.Cancel(RepeatHandle));
+                                               }
+                                           });
+
+    int         OnceCount = 0;
+    TimerHandle OnceHandle;
+    OnceHandle = Wheel.ScheduleOnce(Ticks(5),
+                                    [&Wheel, &OnceCount, &OnceHandle]
+                                    {
+                                        ++OnceCount;
+                                        NEKIRA_CHECK(Wheel.Cancel(OnceHandle));
+                                        NEKIRA_CHECK(!Wheel.Cancel(OnceHandle));
+                                    });
+
+    Wheel.Advance(20);
+
+    NEKIRA_CHECK(RepeatCount == 3);
+    NEKIRA_CHECK(OnceCount == 1);
+    NEKIRA_CHECK(Wheel.Size() == 0);
+
+    // 节点被复用后，旧句柄不能取消新的定时器
+    const auto NewHandle = Wheel.ScheduleOnce(Ticks(1), [] {});
+    NEKIRA_CHECK(!Wheel.Cancel(RepeatHandle));
+    NEKIRA_CHECK(!Wheel.Cancel(OnceHandle));
+    NEKIRA_CHECK(Wheel.IsActive(NewHandle));
+}
+
+struct TimerReceiver : public NekiraDelegate::IConnectionInterface
+{
+    int CallCount = 0;
+
+    void OnTimer()
+    {
+        ++CallCount;
+    }
+};
+
+// 接收者销毁后定时器不再执行，并在下一次到期时被移除
+void TestDestroyedReceiver()
+{
+    auto Wheel = MakeWheel();
+
+    auto Receiver = std::make_unique<TimerReceiver>();
+    int* CallCount = &Receiver->CallCount;
+
+    Wheel.ScheduleRepeating(Ticks(2), Receiver.get(), &TimerReceiver::OnTimer);
+    Wheel.ScheduleOnce(Ticks(100), [] {});
+
+    Wheel.Advance(10);
+    NEKIRA_CHECK(*CallCount == 5);
+    NEKIRA_CHECK(Wheel.Size() == 2);
+
+    Receiver.reset();
+
+    NEKIRA_CHECK(Wheel.Advance(10) == 0);
+    NEKIRA_CHECK(Wheel.Size() == 1);
+}
+
+#undef NEKIRA_CHECK
+} // namespace
+
+
+int main()
+{
+    TestCascadeBoundaries();
+    TestRepeatingTimer();
+    TestSelfCancel();
+    TestDestroyedReceiver();
+
+    if (FailureCount != 0)
+    {
+        std::fprintf(stderr, "%d check(s) failed\n", FailureCount);
+        return 1;
+    }
+    return 0;
+}